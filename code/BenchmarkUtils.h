@@ -0,0 +1,529 @@
+#ifndef _BENCHMARK_UTILS_H_
+#define _BENCHMARK_UTILS_H_
+
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <functional>
+#include <random>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#define BENCHMARK_HAS_TSC
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#include <x86intrin.h>
+#define BENCHMARK_HAS_TSC
+#endif
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#elif defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+//    (HashTableBenchmarks.cpp  .):  ,  ,
+//       .   inline,   
+//    
+
+namespace BenchmarkUtils
+{
+	using Clock = std::chrono::steady_clock;
+
+	inline double elapsedNanoseconds(Clock::time_point _begin, Clock::time_point _end) noexcept
+	{
+		return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(_end - _begin).count());
+	}
+
+	//     ,    
+	template<typename T>
+	inline void doNotOptimize(const T& _value) noexcept
+	{
+#if defined(__GNUC__) || defined(__clang__)
+		asm volatile("" : : "r,m"(_value) : "memory");
+#else
+		static volatile const void* sink;
+		sink = &_value;
+#endif
+	}
+
+	//   64- ( splitmix64):  id   
+	inline uint64_t mixKeyId(uint64_t _id) noexcept
+	{
+		_id ^= _id >> 30;
+		_id *= 0xBF58476D1CE4E5B9ull;
+		_id ^= _id >> 27;
+		_id *= 0x94D049BB133111EBull;
+		return _id ^ (_id >> 31);
+	}
+
+	//Key Types---------------------------------------------------------------------------------------------------------------------------------
+
+	// 64-   ,    
+	struct Struct64
+	{
+		uint64_t words[8];
+
+		bool operator==(const Struct64& _other) const noexcept
+		{
+			return std::memcmp(words, _other.words, sizeof(words)) == 0;
+		}
+	};
+
+	struct Struct64Hash
+	{
+		size_t operator()(const Struct64& _value) const noexcept
+		{
+			uint64_t hash = 0;
+
+			for (uint64_t word : _value.words)
+				hash = mixKeyId(hash ^ word);
+
+			return static_cast<size_t>(hash);
+		}
+	};
+
+	//  ()  T  id.     SSO(12 ),  - 48 
+	template<typename T>
+	struct KeyMaker;
+
+	template<>
+	struct KeyMaker<uint64_t>
+	{
+		static uint64_t make(uint64_t _id)
+		{
+			return _id;
+		}
+	};
+
+	template<>
+	struct KeyMaker<std::string>
+	{
+		static std::string make(uint64_t _id, size_t _length)
+		{
+			static const char digits[] = "0123456789abcdef";
+
+			std::string res(_length, '-');
+
+			for (size_t i = 0; i < 16 && i < _length; ++i)
+				res[_length - 1 - i] = digits[(_id >> (i * 4)) & 0xF];
+
+			return res;
+		}
+	};
+
+	template<>
+	struct KeyMaker<Struct64>
+	{
+		static Struct64 make(uint64_t _id)
+		{
+			Struct64 res;
+
+			for (size_t i = 0; i < 8; ++i)
+				res.words[i] = _id + i;
+
+			return res;
+		}
+	};
+
+	//Distributions-----------------------------------------------------------------------------------------------------------------------------
+
+	enum class Distribution
+	{
+		Uniform,     //  -  id,    
+		Sequential,  //  - id ,     
+		Zipfian      //    Uniform,    (theta = 0.99):     
+	};
+
+	inline const char* distributionName(Distribution _distribution) noexcept
+	{
+		switch (_distribution)
+		{
+		case Distribution::Uniform: return "uniform";
+		case Distribution::Sequential: return "sequential";
+		default: return "zipfian";
+		}
+	}
+
+	//  [0, _count)   ,  Gray et al.("Quickly generating billion-record synthetic databases").
+	//  - O(_count)   zeta,  - O(1)
+	class ZipfianGenerator
+	{
+		uint64_t count;
+		double theta;
+		double alpha;
+		double zetaN;
+		double eta;
+
+		static double zeta(uint64_t _count, double _theta) noexcept
+		{
+			double sum = 0.0;
+
+			for (uint64_t i = 1; i <= _count; ++i)
+				sum += 1.0 / std::pow(static_cast<double>(i), _theta);
+
+			return sum;
+		}
+
+	public:
+
+		explicit ZipfianGenerator(uint64_t _count, double _theta = 0.99) : count(std::max<uint64_t>(_count, 2)), theta(_theta)
+		{
+			zetaN = zeta(count, theta);
+			alpha = 1.0 / (1.0 - theta);
+			eta = (1.0 - std::pow(2.0 / count, 1.0 - theta)) / (1.0 - zeta(2, theta) / zetaN);
+		}
+
+		template<typename Engine>
+		uint64_t operator()(Engine& _engine)
+		{
+			double u = std::uniform_real_distribution<double>(0.0, 1.0)(_engine);
+			double uz = u * zetaN;
+
+			if (uz < 1.0)
+				return 0;
+
+			if (uz < 1.0 + std::pow(0.5, theta))
+				return 1;
+
+			uint64_t res = static_cast<uint64_t>(count * std::pow(eta * u - eta + 1.0, alpha));
+			return std::min(res, count - 1);
+		}
+	};
+
+	// id   _count :  Sequential - 0.._count-1 ,  (mixKeyId).  -
+	//   id  [_count, 2 * _count),     
+	inline uint64_t keyIdFor(uint64_t _index, Distribution _distribution) noexcept
+	{
+		return (_distribution == Distribution::Sequential) ? _index : mixKeyId(_index);
+	}
+
+	inline std::vector<uint64_t> makeInsertIds(size_t _count, Distribution _distribution)
+	{
+		std::vector<uint64_t> ids(_count);
+
+		for (size_t i = 0; i < _count; ++i)
+			ids[i] = keyIdFor(i, _distribution);
+
+		return ids;
+	}
+
+	// _lookupCount id      _count ,   - _hitRatio.
+	//     ,     -    _hitRatio
+	inline std::vector<uint64_t> makeLookupIds(size_t _count, size_t _lookupCount, Distribution _distribution, double _hitRatio,
+		uint64_t _seed)
+	{
+		std::vector<uint64_t> ids(_lookupCount);
+		std::mt19937_64 engine(_seed);
+		std::uniform_real_distribution<double> hitDistribution(0.0, 1.0);
+		std::uniform_int_distribution<uint64_t> uniformIndex(0, _count - 1);
+		ZipfianGenerator zipf(_distribution == Distribution::Zipfian ? _count : 2);
+
+		for (size_t i = 0; i < _lookupCount; ++i)
+		{
+			uint64_t index;
+
+			if (_distribution == Distribution::Sequential)
+				index = i % _count;
+			else if (_distribution == Distribution::Zipfian)
+				index = zipf(engine);
+			else
+				index = uniformIndex(engine);
+
+			bool isHit = hitDistribution(engine) < _hitRatio;
+			ids[i] = keyIdFor(isHit ? index : index + _count, _distribution);
+		}
+
+		return ids;
+	}
+
+	//Statistics--------------------------------------------------------------------------------------------------------------------------------
+
+	struct Summary
+	{
+		double mean = 0.0;
+		double stddev = 0.0;
+		double min = 0.0;
+		double max = 0.0;
+	};
+
+	// ,   ,     
+	inline Summary summarize(const std::vector<double>& _samples)
+	{
+		Summary res;
+
+		if (_samples.empty())
+			return res;
+
+		res.min = *std::min_element(_samples.begin(), _samples.end());
+		res.max = *std::max_element(_samples.begin(), _samples.end());
+
+		for (double sample : _samples)
+			res.mean += sample;
+
+		res.mean /= _samples.size();
+
+		if (_samples.size() > 1)
+		{
+			double sum = 0.0;
+
+			for (double sample : _samples)
+				sum += (sample - res.mean) * (sample - res.mean);
+
+			res.stddev = std::sqrt(sum / (_samples.size() - 1));
+		}
+
+		return res;
+	}
+
+	//Latency-----------------------------------------------------------------------------------------------------------------------------------
+
+	//    :  x86 -  TSC(rdtsc,  10 ns      ),
+	//    -  steady_clock.     - ticksPerNanosecond()
+	inline uint64_t readTimestamp() noexcept
+	{
+#if defined(BENCHMARK_HAS_TSC)
+		return __rdtsc();
+#else
+		return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now().time_since_epoch()).count());
+#endif
+	}
+
+	//   readTimestamp,   ( 50 ms)  steady_clock. 
+	// invariant TSC, ..       
+	inline double ticksPerNanosecond()
+	{
+#if defined(BENCHMARK_HAS_TSC)
+		static const double ratio = []()
+			{
+				Clock::time_point begin = Clock::now();
+				uint64_t beginTicks = readTimestamp();
+
+				while (Clock::now() - begin < std::chrono::milliseconds(50)) {}
+
+				uint64_t endTicks = readTimestamp();
+				return static_cast<double>(endTicks - beginTicks) / elapsedNanoseconds(begin, Clock::now());
+			}();
+
+		return ratio;
+#else
+		return 1.0;
+#endif
+	}
+
+	//      (0  )
+	inline uint32_t bitWidth(uint64_t _value) noexcept
+	{
+		if (_value == 0)
+			return 0;
+
+#if defined(_MSC_VER) && defined(_M_X64)
+		unsigned long index;
+		_BitScanReverse64(&index, _value);
+		return static_cast<uint32_t>(index) + 1;
+#elif defined(__GNUC__) || defined(__clang__)
+		return 64 - static_cast<uint32_t>(__builtin_clzll(_value));
+#else
+		uint32_t res = 0;
+
+		for (; _value; _value >>= 1)
+			++res;
+
+		return res;
+#endif
+	}
+
+	//     HDR:   2^subBucketBits  ,  -  -
+	// (    2^(subBucketBits - 1) ),    
+	//   2^(1 - subBucketBits)(< 1%),   (~7.5K )    
+	class LatencyHistogram
+	{
+		static constexpr uint32_t subBucketBits = 8;
+		static constexpr uint64_t subBucketCount = uint64_t(1) << subBucketBits;
+		static constexpr uint64_t halfSubBucketCount = subBucketCount / 2;
+
+		std::vector<uint64_t> counts;
+		uint64_t totalCount = 0;
+		uint64_t maxValue = 0;
+
+		static size_t indexOf(uint64_t _value) noexcept
+		{
+			if (_value < subBucketCount)
+				return static_cast<size_t>(_value);
+
+			uint32_t shift = bitWidth(_value) - subBucketBits;
+			return static_cast<size_t>(subBucketCount + (shift - 1) * halfSubBucketCount + ((_value >> shift) - halfSubBucketCount));
+		}
+
+		//  ,    _index
+		static uint64_t highestValueAt(size_t _index) noexcept
+		{
+			if (_index < subBucketCount)
+				return _index;
+
+			uint64_t shift = (_index - subBucketCount) / halfSubBucketCount + 1;
+			uint64_t subBucket = (_index - subBucketCount) % halfSubBucketCount + halfSubBucketCount;
+
+			return ((subBucket + 1) << shift) - 1;
+		}
+
+	public:
+
+		LatencyHistogram() : counts(subBucketCount + (64 - subBucketBits) * halfSubBucketCount, 0) {};
+
+		void record(uint64_t _value) noexcept
+		{
+			++counts[indexOf(_value)];
+			++totalCount;
+			maxValue = std::max(maxValue, _value);
+		}
+
+		void merge(const LatencyHistogram& _other) noexcept
+		{
+			for (size_t i = 0; i < counts.size(); ++i)
+				counts[i] += _other.counts[i];
+
+			totalCount += _other.totalCount;
+			maxValue = std::max(maxValue, _other.maxValue);
+		}
+
+		void reset() noexcept
+		{
+			std::fill(counts.begin(), counts.end(), 0);
+			totalCount = 0;
+			maxValue = 0;
+		}
+
+		uint64_t getCount() const noexcept
+		{
+			return totalCount;
+		}
+
+		uint64_t getMax() const noexcept
+		{
+			return maxValue;
+		}
+
+		// ,    _percentile  (  ,    )
+		uint64_t getPercentile(double _percentile) const noexcept
+		{
+			if (totalCount == 0)
+				return 0;
+
+			uint64_t target = static_cast<uint64_t>(std::ceil(_percentile / 100.0 * totalCount));
+			target = std::min(std::max<uint64_t>(target, 1), totalCount);
+
+			uint64_t cumulative = 0;
+
+			for (size_t i = 0; i < counts.size(); ++i)
+			{
+				cumulative += counts[i];
+
+				if (cumulative >= target)
+					return std::min(highestValueAt(i), maxValue);
+			}
+
+			return maxValue;
+		}
+	};
+
+	//Threads-----------------------------------------------------------------------------------------------------------------------------------
+
+	//       _cpu.  false,    
+	//     
+	inline bool pinCurrentThread(size_t _cpu) noexcept
+	{
+#if defined(_WIN32)
+		return SetThreadAffinityMask(GetCurrentThread(), DWORD_PTR(1) << (_cpu % (sizeof(DWORD_PTR) * 8))) != 0;
+#elif defined(__linux__)
+		cpu_set_t set;
+		CPU_ZERO(&set);
+		CPU_SET(_cpu % CPU_SETSIZE, &set);
+
+		return pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+#else
+		(void)_cpu;
+		return false;
+#endif
+	}
+
+	//Command Line------------------------------------------------------------------------------------------------------------------------------
+
+	//   --name=value.  value  _default,   
+	inline std::string getArgument(int _argc, char** _argv, const char* _name, const std::string& _default)
+	{
+		size_t length = std::strlen(_name);
+
+		for (int i = 1; i < _argc; ++i)
+		{
+			if (std::strncmp(_argv[i], "--", 2) == 0 && std::strncmp(_argv[i] + 2, _name, length) == 0 && _argv[i][length + 2] == '=')
+				return _argv[i] + length + 3;
+		}
+
+		return _default;
+	}
+
+	inline bool hasFlag(int _argc, char** _argv, const char* _name)
+	{
+		for (int i = 1; i < _argc; ++i)
+		{
+			if (std::strncmp(_argv[i], "--", 2) == 0 && std::strcmp(_argv[i] + 2, _name) == 0)
+				return true;
+		}
+
+		return false;
+	}
+
+	inline std::vector<std::string> splitList(const std::string& _list)
+	{
+		std::vector<std::string> res;
+		size_t first = 0;
+
+		while (first <= _list.size())
+		{
+			size_t last = _list.find(',', first);
+			if (last == std::string::npos)
+				last = _list.size();
+
+			if (last > first)
+				res.push_back(_list.substr(first, last - first));
+
+			first = last + 1;
+		}
+
+		return res;
+	}
+
+	//     K  M( 10): "64K" -> 64000, "100M" -> 100000000
+	inline size_t parseSize(const std::string& _text)
+	{
+		size_t multiplier = 1;
+		std::string digits = _text;
+
+		if (!digits.empty() && (digits.back() == 'K' || digits.back() == 'k'))
+			multiplier = 1000;
+		else if (!digits.empty() && (digits.back() == 'M' || digits.back() == 'm'))
+			multiplier = 1000000;
+
+		if (multiplier != 1)
+			digits.pop_back();
+
+		return static_cast<size_t>(std::strtoull(digits.c_str(), nullptr, 10)) * multiplier;
+	}
+
+	inline bool listContains(const std::vector<std::string>& _list, const std::string& _value)
+	{
+		return std::find(_list.begin(), _list.end(), _value) != _list.end();
+	}
+}
+
+#endif // !_BENCHMARK_UTILS_H_
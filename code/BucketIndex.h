@@ -0,0 +1,156 @@
+#ifndef _BUCKET_INDEX_H_
+#define _BUCKET_INDEX_H_
+
+#include <cstdint>
+
+namespace BHT_NAMESPACE
+{
+	//  , .. std::hash      
+	inline size_t mixHash(size_t _hash) noexcept
+	{
+		if (sizeof(size_t) == 8)
+		{
+			uint64_t mixed = static_cast<uint64_t>(_hash) * 0x9E3779B97F4A7C15ull;
+			return static_cast<size_t>(mixed ^ (mixed >> 32));
+		}
+
+		uint32_t mixed = static_cast<uint32_t>(_hash) * 0x9E3779B9u;
+		return static_cast<size_t>(mixed ^ (mixed >> 16));
+	}
+
+	//    32   ,   32- 
+	inline uint32_t foldHash32(size_t _hash) noexcept
+	{
+		uint64_t hash = static_cast<uint64_t>(_hash);
+		return static_cast<uint32_t>(hash ^ (hash >> 32));
+	}
+
+
+	//   .  :
+	//  - roundBucketCount(n)      >= n
+	//  - setBucketCount(n)   ( )    
+	//  - index(hash)     [0, n)
+
+	//    ,   
+	struct ModuloIndex
+	{
+		size_t bucketCount = 1;
+
+		static size_t roundBucketCount(size_t _bucketCount) noexcept
+		{
+			return (_bucketCount == 0) ? 1 : _bucketCount;
+		}
+
+		void setBucketCount(size_t _bucketCount) noexcept
+		{
+			bucketCount = _bucketCount;
+		}
+
+		size_t index(size_t _hash) const noexcept
+		{
+			return _hash % bucketCount;
+		}
+	};
+
+	//   -  ,      
+	struct PowerOfTwoIndex
+	{
+		size_t mask = 0;
+
+		static size_t roundBucketCount(size_t _bucketCount) noexcept
+		{
+			size_t count = 1;
+			while (count < _bucketCount && count < (~size_t(0) >> 1) + 1)
+				count <<= 1;
+
+			return count;
+		}
+
+		void setBucketCount(size_t _bucketCount) noexcept
+		{
+			mask = _bucketCount - 1;
+		}
+
+		size_t index(size_t _hash) const noexcept
+		{
+			return mixHash(_hash) & mask;
+		}
+	};
+
+	//   -    ( ),  
+	//     (Lemire, fastmod)   
+	struct PrimeIndex
+	{
+		uint64_t reciprocal = 0;
+		uint32_t divisor = 1;
+
+		static size_t roundBucketCount(size_t _bucketCount) noexcept
+		{
+			static const uint32_t primes[] =
+			{
+				5u, 11u, 23u, 53u, 97u, 193u, 389u, 769u, 1543u, 3079u, 6151u, 12289u, 24593u, 49157u, 98317u,
+				196613u, 393241u, 786433u, 1572869u, 3145739u, 6291469u, 12582917u, 25165843u, 50331653u,
+				100663319u, 201326611u, 402653189u, 805306457u, 1610612741u, 3221225473u, 4294967291u
+			};
+
+			const size_t primeCount = sizeof(primes) / sizeof(primes[0]);
+
+			for (size_t i = 0; i < primeCount; ++i)
+			{
+				if (primes[i] >= _bucketCount)
+					return primes[i];
+			}
+
+			return primes[primeCount - 1];
+		}
+
+		void setBucketCount(size_t _bucketCount) noexcept
+		{
+			divisor = static_cast<uint32_t>(_bucketCount);
+			reciprocal = ~uint64_t(0) / divisor + 1;
+		}
+
+		size_t index(size_t _hash) const noexcept
+		{
+			// (reciprocal * hash) mod 2^64 -   hash / divisor,  64   
+			//  divisor - .  64x32      128- 
+			uint64_t fraction = reciprocal * foldHash32(_hash);
+
+			uint64_t low = (fraction & 0xFFFFFFFFull) * divisor;
+			uint64_t high = (fraction >> 32) * divisor;
+
+			return static_cast<size_t>((high + (low >> 32)) >> 32);
+		}
+	};
+
+	//   ( 2^32 - 1),  -   
+	//  32-    (Lemire, fastrange)
+	struct FastRangeIndex
+	{
+		uint64_t bucketCount = 1;
+
+		static size_t roundBucketCount(size_t _bucketCount) noexcept
+		{
+			if (_bucketCount == 0)
+				return 1;
+
+			if (static_cast<uint64_t>(_bucketCount) > 0xFFFFFFFFull)
+				return static_cast<size_t>(0xFFFFFFFFull);
+
+			return _bucketCount;
+		}
+
+		void setBucketCount(size_t _bucketCount) noexcept
+		{
+			bucketCount = static_cast<uint64_t>(_bucketCount);
+		}
+
+		size_t index(size_t _hash) const noexcept
+		{
+			uint64_t hash32 = static_cast<uint32_t>(mixHash(_hash));
+			return static_cast<size_t>((hash32 * bucketCount) >> 32);
+		}
+	};
+}
+
+#endif // !_BUCKET_INDEX_H_
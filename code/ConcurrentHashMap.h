@@ -0,0 +1,309 @@
+#ifndef _CONCURRENT_HASH_MAP_H_
+#define _CONCURRENT_HASH_MAP_H_
+
+#include <mutex>
+#include <shared_mutex>
+
+#include "HashMap.h"
+
+namespace BHM_NAMESPACE
+{
+	struct ConcurrentHashMapDefaultProperties
+	{
+		static size_t defaultShardCount()
+		{
+			return 64;
+		}
+
+		//  -,    ,        
+		static constexpr size_t shardAlignment = 64;
+	};
+}
+
+
+//  HashMap:    shardCount  HashMap()    .
+//     reader/writer        .
+//    ,         visit
+template<typename KeyType, typename ValueType, typename Hasher = std::hash<KeyType>, typename EqualComp = std::equal_to<KeyType>,
+	typename Storage = BHT_NAMESPACE::ChainedStorage>
+class ConcurrentHashMap
+{
+	using DefProps = BHM_NAMESPACE::ConcurrentHashMapDefaultProperties;
+
+//Public Types----------------------------------------------------------------------------------------------------------------------------------
+public:
+
+	using MapType = HashMap<KeyType, ValueType, Hasher, EqualComp, Storage>;
+	using PairType = typename MapType::PairType;
+	using HasherType = Hasher;
+	using EqualCompType = EqualComp;
+	using StorageType = Storage;
+
+//Included Structs------------------------------------------------------------------------------------------------------------------------------
+private:
+
+	struct alignas(DefProps::shardAlignment) Shard
+	{
+		mutable std::shared_mutex mutex;
+		MapType map;
+	};
+
+	using ReadLock = std::shared_lock<std::shared_mutex>;
+	using WriteLock = std::unique_lock<std::shared_mutex>;
+
+//Properties(fields)----------------------------------------------------------------------------------------------------------------------------
+
+	Shard* shardArray = nullptr;
+	size_t shardCount = 0;
+	size_t shardShift = 0;
+
+	Hasher hasher;
+
+//Private Methods-------------------------------------------------------------------------------------------------------------------------------
+
+	Shard& shardFor(const KeyType& _key) const noexcept
+	{
+		if (shardCount == 1)
+			return shardArray[0];
+
+		//    ,       
+		return shardArray[BHT_NAMESPACE::mixHash(hasher(_key)) >> shardShift];
+	}
+
+	template<typename KT, typename VT>
+	bool innerInsert(KT&& _key, VT&& _value)
+	{
+		Shard& shard = shardFor(_key);
+		WriteLock lock(shard.mutex);
+
+		return !shard.map.insert(std::forward<KT>(_key), std::forward<VT>(_value)).isEnd();
+	}
+
+	template<typename KT, typename VT>
+	bool innerInsertOrAssign(KT&& _key, VT&& _value)
+	{
+		Shard& shard = shardFor(_key);
+		WriteLock lock(shard.mutex);
+
+		return shard.map.insertOrAssign(std::forward<KT>(_key), std::forward<VT>(_value)).second;
+	}
+
+//Public Methods--------------------------------------------------------------------------------------------------------------------------------
+public:
+
+	//Constructors & Destructor-----------------------------------------------------------------------------------------------------------------
+
+	ConcurrentHashMap() : ConcurrentHashMap(DefProps::defaultShardCount()) {};
+
+	//       
+	explicit ConcurrentHashMap(size_t _shardCount)
+	{
+		if (BHT_NAMESPACE::isValidHasher<KeyType, Hasher>) {};
+
+		size_t shardBits = 0;
+		while ((size_t(1) << shardBits) < _shardCount && shardBits + 1 < sizeof(size_t) * 8)
+			++shardBits;
+
+		shardCount = size_t(1) << shardBits;
+		shardShift = sizeof(size_t) * 8 - shardBits;
+		shardArray = new Shard[shardCount];
+	}
+
+	ConcurrentHashMap(const ConcurrentHashMap&) = delete;
+	ConcurrentHashMap& operator=(const ConcurrentHashMap&) = delete;
+
+	~ConcurrentHashMap()
+	{
+		delete[] shardArray;
+	}
+
+	//Getting Properties------------------------------------------------------------------------------------------------------------------------
+
+	size_t getShardCount() const noexcept
+	{
+		return shardCount;
+	}
+
+	//   .         
+	size_t size() const
+	{
+		size_t count = 0;
+
+		for (size_t i = 0; i < shardCount; ++i)
+		{
+			ReadLock lock(shardArray[i].mutex);
+			count += shardArray[i].map.size();
+		}
+
+		return count;
+	}
+
+	bool isEmpty() const
+	{
+		return size() == 0;
+	}
+
+	//Setting Properties------------------------------------------------------------------------------------------------------------------------
+
+	//    _requiredElementCount ,    
+	void reserve(size_t _requiredElementCount)
+	{
+		size_t perShard = _requiredElementCount / shardCount + 1;
+
+		for (size_t i = 0; i < shardCount; ++i)
+		{
+			WriteLock lock(shardArray[i].mutex);
+			shardArray[i].map.reserve(perShard);
+		}
+	}
+
+	//Search------------------------------------------------------------------------------------------------------------------------------------
+
+	//      _key  _result.  false,   
+	bool find(const KeyType& _key, ValueType& _result) const
+	{
+		Shard& shard = shardFor(_key);
+		ReadLock lock(shard.mutex);
+
+		auto res = shard.map.find(_key);
+		if (res.isEnd())
+			return false;
+
+		_result = res->second;
+		return true;
+	}
+
+	bool contains(const KeyType& _key) const
+	{
+		Shard& shard = shardFor(_key);
+		ReadLock lock(shard.mutex);
+
+		return shard.map.contains(_key);
+	}
+
+	//Visiting----------------------------------------------------------------------------------------------------------------------------------
+
+	//  _func(const KeyType&, ValueType&)     _key     .
+	//  false,   . _func       
+	template<typename Func>
+	bool visit(const KeyType& _key, Func _func)
+	{
+		Shard& shard = shardFor(_key);
+		WriteLock lock(shard.mutex);
+
+		auto res = shard.map.find(_key);
+		if (res.isEnd())
+			return false;
+
+		_func(static_cast<const KeyType&>(res->first), res->second);
+		return true;
+	}
+
+	//  _func(const KeyType&, const ValueType&)     
+	template<typename Func>
+	bool visit(const KeyType& _key, Func _func) const
+	{
+		Shard& shard = shardFor(_key);
+		ReadLock lock(shard.mutex);
+
+		auto res = shard.map.find(_key);
+		if (res.isEnd())
+			return false;
+
+		_func(res->first, res->second);
+		return true;
+	}
+
+	//   ,    . ,      ,
+	//    ,   
+	template<typename Func>
+	void visitAll(Func _func)
+	{
+		for (size_t i = 0; i < shardCount; ++i)
+		{
+			WriteLock lock(shardArray[i].mutex);
+
+			for (auto& pair : shardArray[i].map)
+				_func(static_cast<const KeyType&>(pair.first), pair.second);
+		}
+	}
+
+	template<typename Func>
+	void visitAll(Func _func) const
+	{
+		for (size_t i = 0; i < shardCount; ++i)
+		{
+			ReadLock lock(shardArray[i].mutex);
+
+			for (const auto& pair : shardArray[i].map)
+				_func(pair.first, pair.second);
+		}
+	}
+
+	//Insertion---------------------------------------------------------------------------------------------------------------------------------
+
+	//  ,      .  true,   
+	bool insert(const KeyType& _key, const ValueType& _value)
+	{
+		return innerInsert(_key, _value);
+	}
+
+	bool insert(KeyType&& _key, const ValueType& _value)
+	{
+		return innerInsert(std::move(_key), _value);
+	}
+
+	bool insert(const KeyType& _key, ValueType&& _value)
+	{
+		return innerInsert(_key, std::move(_value));
+	}
+
+	bool insert(KeyType&& _key, ValueType&& _value)
+	{
+		return innerInsert(std::move(_key), std::move(_value));
+	}
+
+	//      .  true,   
+	bool insertOrAssign(const KeyType& _key, const ValueType& _value)
+	{
+		return innerInsertOrAssign(_key, _value);
+	}
+
+	bool insertOrAssign(KeyType&& _key, const ValueType& _value)
+	{
+		return innerInsertOrAssign(std::move(_key), _value);
+	}
+
+	bool insertOrAssign(const KeyType& _key, ValueType&& _value)
+	{
+		return innerInsertOrAssign(_key, std::move(_value));
+	}
+
+	bool insertOrAssign(KeyType&& _key, ValueType&& _value)
+	{
+		return innerInsertOrAssign(std::move(_key), std::move(_value));
+	}
+
+	//Erasing-----------------------------------------------------------------------------------------------------------------------------------
+
+	size_t erase(const KeyType& _key)
+	{
+		Shard& shard = shardFor(_key);
+		WriteLock lock(shard.mutex);
+
+		return shard.map.erase(_key);
+	}
+
+	//Modifying---------------------------------------------------------------------------------------------------------------------------------
+
+	void clear()
+	{
+		for (size_t i = 0; i < shardCount; ++i)
+		{
+			WriteLock lock(shardArray[i].mutex);
+			shardArray[i].map.clear();
+		}
+	}
+};
+
+#endif // !_CONCURRENT_HASH_MAP_H_
@@ -0,0 +1,124 @@
+//  - ConcurrentHashMap:   , ,   visit  
+//  ,       .      .
+//        ThreadSanitizer.
+//
+// (  code): g++ -O1 -g -std=c++17 -fsanitize=thread -pthread ConcurrentHashMapStressTest.cpp -o ConcurrentHashMapStressTest
+//
+// ( ):
+//   --threads=8                          
+//   --keys=20K                              ,  K  M
+//   --shards=16                          
+//
+//   0,    ,  1      stderr
+
+#include <cstdio>
+#include <cstdlib>
+#include <algorithm>
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+#include <functional>
+
+#include "ConcurrentHashMap.h"
+#include "BenchmarkUtils.h"
+
+using namespace BenchmarkUtils;
+
+namespace
+{
+	std::atomic<size_t> failureCount{ 0 };
+
+	// assert  :     NDEBUG
+	void check(bool _condition, const char* _description)
+	{
+		if (!_condition && failureCount.fetch_add(1, std::memory_order_relaxed) < 10)
+			std::fprintf(stderr, "check failed: %s\n", _description);
+	}
+
+	const size_t sharedKey = ~static_cast<size_t>(0);
+	const size_t sharedIncrements = 1000;
+	const size_t assignedValue = 7;
+
+	using MapType = ConcurrentHashMap<size_t, size_t>;
+
+	//   _thread: [_thread * _keyCount, (_thread + 1) * _keyCount)
+	void runThread(MapType& _map, size_t _thread, size_t _keyCount)
+	{
+		size_t first = _thread * _keyCount;
+
+		for (size_t key = first; key < first + _keyCount; ++key)
+		{
+			check(_map.insert(key, key), "insert of a new key returns true");
+			check(!_map.insert(key, static_cast<size_t>(0)), "insert of an existing key returns false");
+		}
+
+		for (size_t key = first; key < first + _keyCount; ++key)
+		{
+			size_t value = 0;
+
+			check(_map.find(key, value) && value == key, "find returns the inserted value");
+			check(_map.visit(key, [](const size_t&, size_t& _value) { ++_value; }), "visit finds the key");
+		}
+
+		for (size_t key = first; key < first + _keyCount; key += 2)
+			check(_map.erase(key) == 1, "erase removes an existing key");
+
+		for (size_t key = first + 1; key < first + _keyCount; key += 2)
+			check(!_map.insertOrAssign(key, assignedValue), "insertOrAssign of an existing key assigns");
+
+		//      ,   insert  false.   
+		//      
+		_map.insert(sharedKey, static_cast<size_t>(0));
+
+		for (size_t i = 0; i < sharedIncrements; ++i)
+			_map.visit(sharedKey, [](const size_t&, size_t& _value) { ++_value; });
+	}
+}
+
+int main(int _argc, char** _argv)
+{
+	size_t threadCount = std::max<size_t>(parseSize(getArgument(_argc, _argv, "threads", "8")), 1);
+	size_t keyCount = std::max<size_t>(parseSize(getArgument(_argc, _argv, "keys", "20K")), 2);
+	size_t shardCount = std::max<size_t>(parseSize(getArgument(_argc, _argv, "shards", "16")), 1);
+
+	MapType map(shardCount);
+
+	std::vector<std::thread> threads;
+
+	for (size_t t = 0; t < threadCount; ++t)
+		threads.emplace_back(runThread, std::ref(map), t, keyCount);
+
+	for (std::thread& thread : threads)
+		thread.join();
+
+	//         assignedValue,   
+	size_t expectedSize = threadCount * (keyCount / 2) + 1;
+	size_t sharedValue = 0;
+
+	check(map.size() == expectedSize, "size after all threads finished");
+	check(map.find(sharedKey, sharedValue) && sharedValue == threadCount * sharedIncrements, "shared key counted every increment");
+
+	size_t visitedCount = 0;
+	bool valuesMatch = true;
+
+	map.visitAll([&visitedCount, &valuesMatch, keyCount](const size_t& _key, size_t& _value)
+		{
+			++visitedCount;
+
+			if (_key != sharedKey && ((_key % keyCount) % 2 == 0 || _value != assignedValue))
+				valuesMatch = false;
+		});
+
+	check(visitedCount == expectedSize && valuesMatch, "visitAll sees exactly the remaining keys");
+
+	map.clear();
+	check(map.isEmpty(), "clear empties the map");
+
+	size_t failures = failureCount.load();
+
+	std::printf("threads %zu, keys per thread %zu, shards %zu: %s\n", threadCount, keyCount, shardCount,
+		failures == 0 ? "OK" : "FAILED");
+
+	return failures == 0 ? 0 : 1;
+}
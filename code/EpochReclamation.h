@@ -0,0 +1,238 @@
+#ifndef _EPOCH_RECLAMATION_H_
+#define _EPOCH_RECLAMATION_H_
+
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+namespace BHT_NAMESPACE
+{
+	class EpochDomain;
+	class EpochGuard;
+	class EpochRetireList;
+
+	EpochDomain& globalEpochDomain();
+}
+
+
+//    ,      .
+//           ,    
+//       ,        .
+//   - globalEpochDomain(), ..     thread_local 
+class BHT_NAMESPACE::EpochDomain
+{
+	friend class EpochGuard;
+	friend EpochDomain& globalEpochDomain();
+
+//Included Structs------------------------------------------------------------------------------------------------------------------------------
+
+	//  .   ,       
+	struct alignas(64) ThreadRecord
+	{
+		std::atomic<uint64_t> epoch{ 0 }; // 0 -    
+		std::atomic<bool> inUse{ true };
+		size_t depth = 0; //  EpochGuard,   -
+		ThreadRecord* next = nullptr;
+	};
+
+	struct RecordHolder
+	{
+		ThreadRecord* record = nullptr;
+
+		~RecordHolder()
+		{
+			if (record)
+				record->inUse.store(false, std::memory_order_release);
+		}
+	};
+
+//Properties(fields)----------------------------------------------------------------------------------------------------------------------------
+
+	std::atomic<uint64_t> globalEpoch{ 1 };
+	std::atomic<ThreadRecord*> recordList{ nullptr };
+
+//Private Methods-------------------------------------------------------------------------------------------------------------------------------
+
+	ThreadRecord* acquireRecord()
+	{
+		for (ThreadRecord* current = recordList.load(std::memory_order_acquire); current; current = current->next)
+		{
+			bool expected = false;
+
+			if (!current->inUse.load(std::memory_order_relaxed) &&
+				current->inUse.compare_exchange_strong(expected, true, std::memory_order_acquire))
+				return current;
+		}
+
+		ThreadRecord* record = new ThreadRecord;
+		record->next = recordList.load(std::memory_order_relaxed);
+
+		while (!recordList.compare_exchange_weak(record->next, record, std::memory_order_release, std::memory_order_relaxed)) {};
+
+		return record;
+	}
+
+	//   .       
+	ThreadRecord* localRecord()
+	{
+		static thread_local RecordHolder holder;
+
+		if (!holder.record)
+			holder.record = acquireRecord();
+
+		return holder.record;
+	}
+
+	EpochDomain() = default;
+
+//Public Methods--------------------------------------------------------------------------------------------------------------------------------
+public:
+
+	EpochDomain(const EpochDomain&) = delete;
+	EpochDomain& operator=(const EpochDomain&) = delete;
+
+	uint64_t currentEpoch() const noexcept
+	{
+		return globalEpoch.load(std::memory_order_relaxed);
+	}
+
+	void advanceEpoch() noexcept
+	{
+		globalEpoch.fetch_add(1, std::memory_order_acq_rel);
+	}
+
+	//     ,  UINT64_MAX   
+	uint64_t minActiveEpoch() const noexcept
+	{
+		//         
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+
+		uint64_t result = UINT64_MAX;
+
+		for (ThreadRecord* current = recordList.load(std::memory_order_acquire); current; current = current->next)
+		{
+			uint64_t epoch = current->epoch.load(std::memory_order_acquire);
+
+			if (epoch != 0 && epoch < result)
+				result = epoch;
+		}
+
+		return result;
+	}
+};
+
+
+//  :   , ,      ,  .
+//      read-modify-write ,  store  
+class BHT_NAMESPACE::EpochGuard
+{
+	EpochDomain::ThreadRecord* record;
+
+public:
+
+	EpochGuard()
+	{
+		EpochDomain& domain = globalEpochDomain();
+		record = domain.localRecord();
+
+		if (record->depth++ == 0)
+		{
+			record->epoch.store(domain.currentEpoch(), std::memory_order_relaxed);
+
+			//         
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+		}
+	}
+
+	EpochGuard(const EpochGuard&) = delete;
+	EpochGuard& operator=(const EpochGuard&) = delete;
+
+	~EpochGuard()
+	{
+		if (--record->depth == 0)
+			record->epoch.store(0, std::memory_order_release);
+	}
+};
+
+
+//     (     )
+class BHT_NAMESPACE::EpochRetireList
+{
+//Included Structs------------------------------------------------------------------------------------------------------------------------------
+
+	struct Retired
+	{
+		void* object;
+		void (*deleter)(void*);
+		uint64_t epoch;
+	};
+
+//Properties(fields)----------------------------------------------------------------------------------------------------------------------------
+
+	EpochDomain& domain = globalEpochDomain();
+	std::vector<Retired> retiredList;
+	size_t reclaimThreshold = 64;
+
+//Public Methods--------------------------------------------------------------------------------------------------------------------------------
+public:
+
+	EpochRetireList() = default;
+
+	EpochRetireList(const EpochRetireList&) = delete;
+	EpochRetireList& operator=(const EpochRetireList&) = delete;
+
+	//    . ,    
+	~EpochRetireList()
+	{
+		for (Retired& retired : retiredList)
+			retired.deleter(retired.object);
+	}
+
+	// _object         
+	template<typename T>
+	void retire(T* _object)
+	{
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+
+		retiredList.push_back(Retired{ _object, [](void* _ptr) { delete static_cast<T*>(_ptr); }, domain.currentEpoch() });
+
+		if (retiredList.size() >= reclaimThreshold)
+			reclaim();
+	}
+
+	void reclaim()
+	{
+		domain.advanceEpoch();
+
+		uint64_t minActive = domain.minActiveEpoch();
+		size_t kept = 0;
+
+		//   ,         
+		for (size_t i = 0; i < retiredList.size(); ++i)
+		{
+			if (retiredList[i].epoch < minActive)
+				retiredList[i].deleter(retiredList[i].object);
+			else
+				retiredList[kept++] = retiredList[i];
+		}
+
+		retiredList.resize(kept);
+
+		//      ,   
+		reclaimThreshold = (kept * 2 > 64) ? kept * 2 : 64;
+	}
+
+	size_t size() const noexcept
+	{
+		return retiredList.size();
+	}
+};
+
+
+inline BHT_NAMESPACE::EpochDomain& BHT_NAMESPACE::globalEpochDomain()
+{
+	static EpochDomain domain;
+	return domain;
+}
+
+#endif // !_EPOCH_RECLAMATION_H_
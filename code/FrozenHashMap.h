@@ -0,0 +1,181 @@
+#ifndef _FROZEN_HASH_MAP_H_
+#define _FROZEN_HASH_MAP_H_
+
+#include <utility>
+#include <vector>
+#include <functional>
+#include <algorithm>
+
+#include "PerfectHash.h"
+
+//  map    -(PerfectHash.h).     
+//  ,   ,   -  ,       ,
+//    .     HashMap,   HashMap::freeze   
+template<typename KeyType, typename ValueType, typename Hasher = std::hash<KeyType>, typename EqualComp = std::equal_to<KeyType>>
+class FrozenHashMap
+{
+//Public Types----------------------------------------------------------------------------------------------------------------------------------
+public:
+
+	using PairType = std::pair<KeyType, ValueType>;
+	using HasherType = Hasher;
+	using EqualCompType = EqualComp;
+
+	//   ,   -   
+	using ConstIteratorType = const PairType*;
+
+//Properties(fields)----------------------------------------------------------------------------------------------------------------------------
+private:
+
+	// entries[i]  i < index.getSlotCount() -    i,      
+	// (   ),   ,   -  overflowHashes
+	std::vector<PairType> entries;
+	std::vector<size_t> overflowHashes;
+	BHT_NAMESPACE::PerfectHashIndex index;
+
+	Hasher hasher;
+	EqualComp comp;
+
+//Private Methods-------------------------------------------------------------------------------------------------------------------------------
+
+	void build(std::vector<PairType>&& _pairs)
+	{
+		std::vector<size_t> hashes(_pairs.size());
+
+		for (size_t i = 0; i < _pairs.size(); ++i)
+			hashes[i] = hasher(_pairs[i].first);
+
+		std::vector<size_t> order;
+		index.build(hashes, order, overflowHashes);
+
+		entries.reserve(_pairs.size());
+
+		for (size_t i : order)
+			entries.push_back(std::move(_pairs[i]));
+	}
+
+	ConstIteratorType findOverflow(const KeyType& _key, size_t _hash) const noexcept
+	{
+		auto first = std::lower_bound(overflowHashes.begin(), overflowHashes.end(), _hash);
+
+		for (; first != overflowHashes.end() && *first == _hash; ++first)
+		{
+			const PairType* entry = entries.data() + index.getSlotCount() + (first - overflowHashes.begin());
+
+			if (comp(_key, entry->first))
+				return entry;
+		}
+
+		return end();
+	}
+
+//Public Methods--------------------------------------------------------------------------------------------------------------------------------
+public:
+
+	//Constructors------------------------------------------------------------------------------------------------------------------------------
+
+	FrozenHashMap() = default;
+
+	//  map     
+	explicit FrozenHashMap(std::vector<PairType>&& _pairs)
+	{
+		build(std::move(_pairs));
+	}
+
+	//  map   [_first, _last)    
+	template<typename InputIterator>
+	FrozenHashMap(InputIterator _first, InputIterator _last)
+	{
+		std::vector<PairType> pairs;
+
+		for (; _first != _last; ++_first)
+			pairs.push_back(*_first);
+
+		build(std::move(pairs));
+	}
+
+	FrozenHashMap(const FrozenHashMap& _other) = default;
+
+	FrozenHashMap(FrozenHashMap&& _other) noexcept
+	{
+		swap(_other);
+	}
+
+	FrozenHashMap& operator=(const FrozenHashMap& _other) = default;
+
+	FrozenHashMap& operator=(FrozenHashMap&& _other) noexcept
+	{
+		FrozenHashMap temp(std::move(_other));
+		swap(temp);
+
+		return *this;
+	}
+
+	//Getting Properties------------------------------------------------------------------------------------------------------------------------
+
+	size_t size() const noexcept
+	{
+		return entries.size();
+	}
+
+	bool isEmpty() const noexcept
+	{
+		return entries.empty();
+	}
+
+	// ,  ,     
+	size_t getMemoryBytes() const noexcept
+	{
+		return entries.capacity() * sizeof(PairType) + overflowHashes.capacity() * sizeof(size_t) + index.getMemoryBytes();
+	}
+
+	//Search------------------------------------------------------------------------------------------------------------------------------------
+
+	//       _key  end()
+	ConstIteratorType find(const KeyType& _key) const noexcept
+	{
+		if (entries.empty())
+			return end();
+
+		size_t hash = hasher(_key);
+		const PairType* entry = entries.data() + index.position(hash);
+
+		if (comp(_key, entry->first))
+			return entry;
+
+		if (!overflowHashes.empty())
+			return findOverflow(_key, hash);
+
+		return end();
+	}
+
+	bool contains(const KeyType& _key) const noexcept
+	{
+		return find(_key) != end();
+	}
+
+	//Iterator----------------------------------------------------------------------------------------------------------------------------------
+
+	ConstIteratorType begin() const noexcept
+	{
+		return entries.data();
+	}
+
+	ConstIteratorType end() const noexcept
+	{
+		return entries.data() + entries.size();
+	}
+
+	//Modifying---------------------------------------------------------------------------------------------------------------------------------
+
+	void swap(FrozenHashMap& _other) noexcept
+	{
+		entries.swap(_other.entries);
+		overflowHashes.swap(_other.overflowHashes);
+		index.swap(_other.index);
+		std::swap(hasher, _other.hasher);
+		std::swap(comp, _other.comp);
+	}
+};
+
+#endif // !_FROZEN_HASH_MAP_H_
@@ -0,0 +1,179 @@
+#ifndef _FROZEN_HASH_SET_H_
+#define _FROZEN_HASH_SET_H_
+
+#include <utility>
+#include <vector>
+#include <functional>
+#include <algorithm>
+
+#include "PerfectHash.h"
+
+//  set    -(PerfectHash.h),   FrozenHashMap.
+//   HashSet::freeze   
+template<typename KeyType, typename Hasher = std::hash<KeyType>, typename EqualComp = std::equal_to<KeyType>>
+class FrozenHashSet
+{
+//Public Types----------------------------------------------------------------------------------------------------------------------------------
+public:
+
+	using HasherType = Hasher;
+	using EqualCompType = EqualComp;
+
+	//   ,   -   
+	using ConstIteratorType = const KeyType*;
+
+//Properties(fields)----------------------------------------------------------------------------------------------------------------------------
+private:
+
+	// keys[i]  i < index.getSlotCount() -    i,      ,
+	//   ,   -  overflowHashes
+	std::vector<KeyType> keys;
+	std::vector<size_t> overflowHashes;
+	BHT_NAMESPACE::PerfectHashIndex index;
+
+	Hasher hasher;
+	EqualComp comp;
+
+//Private Methods-------------------------------------------------------------------------------------------------------------------------------
+
+	void build(std::vector<KeyType>&& _keys)
+	{
+		std::vector<size_t> hashes(_keys.size());
+
+		for (size_t i = 0; i < _keys.size(); ++i)
+			hashes[i] = hasher(_keys[i]);
+
+		std::vector<size_t> order;
+		index.build(hashes, order, overflowHashes);
+
+		keys.reserve(_keys.size());
+
+		for (size_t i : order)
+			keys.push_back(std::move(_keys[i]));
+	}
+
+	ConstIteratorType findOverflow(const KeyType& _key, size_t _hash) const noexcept
+	{
+		auto first = std::lower_bound(overflowHashes.begin(), overflowHashes.end(), _hash);
+
+		for (; first != overflowHashes.end() && *first == _hash; ++first)
+		{
+			const KeyType* key = keys.data() + index.getSlotCount() + (first - overflowHashes.begin());
+
+			if (comp(_key, *key))
+				return key;
+		}
+
+		return end();
+	}
+
+//Public Methods--------------------------------------------------------------------------------------------------------------------------------
+public:
+
+	//Constructors------------------------------------------------------------------------------------------------------------------------------
+
+	FrozenHashSet() = default;
+
+	//  set   
+	explicit FrozenHashSet(std::vector<KeyType>&& _keys)
+	{
+		build(std::move(_keys));
+	}
+
+	//  set   [_first, _last)  
+	template<typename InputIterator>
+	FrozenHashSet(InputIterator _first, InputIterator _last)
+	{
+		std::vector<KeyType> source;
+
+		for (; _first != _last; ++_first)
+			source.push_back(*_first);
+
+		build(std::move(source));
+	}
+
+	FrozenHashSet(const FrozenHashSet& _other) = default;
+
+	FrozenHashSet(FrozenHashSet&& _other) noexcept
+	{
+		swap(_other);
+	}
+
+	FrozenHashSet& operator=(const FrozenHashSet& _other) = default;
+
+	FrozenHashSet& operator=(FrozenHashSet&& _other) noexcept
+	{
+		FrozenHashSet temp(std::move(_other));
+		swap(temp);
+
+		return *this;
+	}
+
+	//Getting Properties------------------------------------------------------------------------------------------------------------------------
+
+	size_t size() const noexcept
+	{
+		return keys.size();
+	}
+
+	bool isEmpty() const noexcept
+	{
+		return keys.empty();
+	}
+
+	// ,  ,     
+	size_t getMemoryBytes() const noexcept
+	{
+		return keys.capacity() * sizeof(KeyType) + overflowHashes.capacity() * sizeof(size_t) + index.getMemoryBytes();
+	}
+
+	//Search------------------------------------------------------------------------------------------------------------------------------------
+
+	//    ,  _key,  end()
+	ConstIteratorType find(const KeyType& _key) const noexcept
+	{
+		if (keys.empty())
+			return end();
+
+		size_t hash = hasher(_key);
+		const KeyType* key = keys.data() + index.position(hash);
+
+		if (comp(_key, *key))
+			return key;
+
+		if (!overflowHashes.empty())
+			return findOverflow(_key, hash);
+
+		return end();
+	}
+
+	bool contains(const KeyType& _key) const noexcept
+	{
+		return find(_key) != end();
+	}
+
+	//Iterator----------------------------------------------------------------------------------------------------------------------------------
+
+	ConstIteratorType begin() const noexcept
+	{
+		return keys.data();
+	}
+
+	ConstIteratorType end() const noexcept
+	{
+		return keys.data() + keys.size();
+	}
+
+	//Modifying---------------------------------------------------------------------------------------------------------------------------------
+
+	void swap(FrozenHashSet& _other) noexcept
+	{
+		keys.swap(_other.keys);
+		overflowHashes.swap(_other.overflowHashes);
+		index.swap(_other.index);
+		std::swap(hasher, _other.hasher);
+		std::swap(comp, _other.comp);
+	}
+};
+
+#endif // !_FROZEN_HASH_SET_H_
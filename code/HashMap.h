@@ -1,8 +1,18 @@
 #ifndef _HASH_MAP_H_
 #define _HASH_MAP_H_
 
+#include <tuple>
+
+#if __has_include(<memory_resource>)
+#include <memory_resource>
+#endif
+
 #include "HashTableBasic.h"
+#include "SwissTableBasic.h"
+#include "OrderedTableBasic.h"
 #include "BiderectionalIterators.h"
+#include "HashSnapshot.h"
+#include "FrozenHashMap.h"
 
 template<typename HashMap>
 class HashMapIterator;
@@ -13,45 +23,90 @@ class ConstHashMapIterator;
 
 namespace BHM_NAMESPACE
 {
-	template<typename _KeyType, typename _ValueType>
+	template<typename _KeyType, typename _ValueType, typename _NodeHash, typename _ChainLinks>
 	struct HashMapNode;
 
-	template<bool _Multi, typename _NodeType, typename _Hasher, typename _EqualComp>
+	template<typename _KeyType, typename _ValueType>
+	struct HashMapSlot;
+
+	//  ,     
+	template<typename _Storage, typename _KeyType, typename _ValueType>
+	using HashMapNodeFor = typename std::conditional<_Storage::isFlat, HashMapSlot<_KeyType, _ValueType>,
+		HashMapNode<_KeyType, _ValueType, typename BHT_NAMESPACE::StorageNodeHash<_Storage>::type,
+			typename BHT_NAMESPACE::StorageChainLinks<_Storage>::type>>::type;
+
+	template<bool _Multi, typename _NodeType, typename _Hasher, typename _EqualComp, typename _Storage, typename _Allocator>
 	class BasicHashMap;
 }
 
 
-template<typename _KeyType, typename _ValueType>
-struct BHM_NAMESPACE::HashMapNode
+//       _ChainLinks::Links(DoublyLinkedChain, SinglyLinkedChain),
+// (  ) -    _NodeHash(FullNodeHash, TagNodeHash, NoNodeHash)
+template<typename _KeyType, typename _ValueType, typename _NodeHash, typename _ChainLinks>
+struct BHM_NAMESPACE::HashMapNode : _ChainLinks::template Links<HashMapNode<_KeyType, _ValueType, _NodeHash, _ChainLinks>>, _NodeHash
 {
 	using KeyType = _KeyType;
 	using ValueType = _ValueType;
 	using PairType = std::pair<KeyType, ValueType>;
+	using PayloadType = PairType;
 
-	const size_t hash;
 	PairType pair;
 
-	HashMapNode* prev = nullptr;
-	HashMapNode* next = nullptr;
-
 	template<typename KT, typename VT>
 	HashMapNode(size_t _hash, KT&& _key, VT&& _value) :
-		hash(_hash), pair(std::forward<KT>(_key), std::forward<VT>(_value)) {};
+		_NodeHash(_hash), pair(std::forward<KT>(_key), std::forward<VT>(_value)) {};
 
 	template<typename Pair>
 	HashMapNode(size_t _hash, Pair&& _pair) :
-		hash(_hash), pair(std::forward<Pair>(_pair)) {};
+		_NodeHash(_hash), pair(std::forward<Pair>(_pair)) {};
+
+	//         
+	template<typename KeyArgs, typename ValueArgs>
+	HashMapNode(size_t _hash, std::piecewise_construct_t, KeyArgs&& _keyArgs, ValueArgs&& _valueArgs) :
+		_NodeHash(_hash), pair(std::piecewise_construct, std::forward<KeyArgs>(_keyArgs), std::forward<ValueArgs>(_valueArgs)) {};
 
 	HashMapNode(HashMapNode* _other) :
-		hash(_other->hash), pair(_other->pair) {};
+		_NodeHash(*_other), pair(_other->pair) {};
 
 
 	const KeyType& getKey() const noexcept { return pair.first; }
 };
 
 
-template<bool _Multi, typename _NodeType, typename _Hasher, typename _EqualComp>
-class BHM_NAMESPACE::BasicHashMap : public BHT_NAMESPACE::HashTable<_Multi, _NodeType, _Hasher, _EqualComp>
+template<typename _KeyType, typename _ValueType>
+struct BHM_NAMESPACE::HashMapSlot
+{
+	using KeyType = _KeyType;
+	using ValueType = _ValueType;
+	using PairType = std::pair<KeyType, ValueType>;
+	using PayloadType = PairType;
+
+	PairType pair;
+
+	//     ,      HashMapNode
+	template<typename KT, typename VT>
+	HashMapSlot(size_t, KT&& _key, VT&& _value) :
+		pair(std::forward<KT>(_key), std::forward<VT>(_value)) {};
+
+	template<typename Pair>
+	HashMapSlot(size_t, Pair&& _pair) :
+		pair(std::forward<Pair>(_pair)) {};
+
+	template<typename KeyArgs, typename ValueArgs>
+	HashMapSlot(size_t, std::piecewise_construct_t, KeyArgs&& _keyArgs, ValueArgs&& _valueArgs) :
+		pair(std::piecewise_construct, std::forward<KeyArgs>(_keyArgs), std::forward<ValueArgs>(_valueArgs)) {};
+
+	HashMapSlot(HashMapSlot* _other) :
+		pair(_other->pair) {};
+
+
+	const KeyType& getKey() const noexcept { return pair.first; }
+};
+
+
+// _Allocator   ,     rebind'    
+template<bool _Multi, typename _NodeType, typename _Hasher, typename _EqualComp, typename _Storage, typename _Allocator>
+class BHM_NAMESPACE::BasicHashMap : public _Storage::template Table<_Multi, _NodeType, _Hasher, _EqualComp, _Allocator>
 {
 //Public Types-------------------------------------------------------------------------------------------------------------------------------
 public:
@@ -61,20 +116,30 @@ public:
 	using PairType = typename _NodeType::PairType;
 	using HasherType = _Hasher;
 	using EqualCompType = _EqualComp;
+	using StorageType = _Storage;
+	using AllocatorType = _Allocator;
 	using IteratorType = HashMapIterator<BasicHashMap>;
 	using ConstIteratorType = ConstHashMapIterator<BasicHashMap>;
 
 //Private Types & Usings------------------------------------------------------------------------------------------------------------------------
 private:
 
-	using NodeType = HashMapNode<KeyType, ValueType>;
-	using BasicHashTable = BHT_NAMESPACE::HashTable<_Multi, NodeType, HasherType, EqualCompType>;
+	using NodeType = _NodeType;
+	using BasicHashTable = typename StorageType::template Table<_Multi, NodeType, HasherType, EqualCompType, AllocatorType>;
+	using AllocatorTraits = std::allocator_traits<AllocatorType>;
 	using BasicHashTable::hasher;
 	using BasicHashTable::bucketCount;
 	using BasicHashTable::innerMapInsert;
 	using BasicHashTable::innerMapPairInsert;
+	using BasicHashTable::innerEmplace;
 	using BasicHashTable::eraseSingleNode;
+	using BasicHashTable::innerEraseKey;
+	using BasicHashTable::checkShrink;
 	using BasicHashTable::innerFind;
+	using BasicHashTable::innerFindBatch;
+	using BasicHashTable::innerBuild;
+	using BasicHashTable::visitUnitCount;
+	using BasicHashTable::forEachNodeInUnits;
 	using BasicHashTable::markEqualRange;
 	using BasicHashTable::copyConstruct;
 	using BasicHashTable::moveConstruct;
@@ -84,8 +149,8 @@ private:
 	using BasicHashTable::endPtr;
 
 	friend class BD_ITER_NAMESPACE::BDIterator<BasicHashMap>;
-	friend class IteratorType;
-	friend class ConstIteratorType;
+	friend IteratorType;
+	friend ConstIteratorType;
 
 //Protected Methods---------------------------------------------------------------------------------------------------------------------------
 protected:
@@ -94,25 +159,38 @@ protected:
 
 	BasicHashMap() : BasicHashTable() {};
 
-	BasicHashMap(size_t _bucketCount) : BasicHashTable(_bucketCount) {};
+	explicit BasicHashMap(const AllocatorType& _allocator) : BasicHashTable(_allocator) {};
 
-	BasicHashMap(size_t _bucketCount, std::initializer_list<PairType> _initList) : BasicHashTable(_bucketCount)
+	BasicHashMap(size_t _bucketCount, const AllocatorType& _allocator = AllocatorType()) : BasicHashTable(_bucketCount, _allocator) {};
+
+	BasicHashMap(size_t _bucketCount, std::initializer_list<PairType> _initList, const AllocatorType& _allocator = AllocatorType()) :
+		BasicHashTable(_bucketCount, _allocator)
 	{
 		insert(_initList);
 	}
 
 	template<typename InputIterator>
-	BasicHashMap(size_t _bucketCount, InputIterator _first, InputIterator _last) : BasicHashTable(_bucketCount)
+	BasicHashMap(size_t _bucketCount, InputIterator _first, InputIterator _last, const AllocatorType& _allocator = AllocatorType()) :
+		BasicHashTable(_bucketCount, _allocator)
 	{
 		insert(_first, _last);
 	}
 
-	BasicHashMap(const BasicHashMap& _other) : BasicHashTable()
+	//    select_on_container_copy_construction(std::pmr::polymorphic_allocator
+	//    ,    _other)
+	BasicHashMap(const BasicHashMap& _other) :
+		BasicHashTable(AllocatorTraits::select_on_container_copy_construction(_other.getAllocator()))
+	{
+		copyConstruct(_other);
+	}
+
+	BasicHashMap(const BasicHashMap& _other, const AllocatorType& _allocator) : BasicHashTable(_allocator)
 	{
 		copyConstruct(_other);
 	}
 
-	BasicHashMap(BasicHashMap&& _other) : BasicHashTable()
+	//      ,        
+	BasicHashMap(BasicHashMap&& _other) noexcept : BasicHashTable(_other.getAllocator())
 	{
 		moveConstruct(_other);
 	}
@@ -166,20 +244,110 @@ public:
 			innerMapPairInsert(*_first);
 			++_first;
 		}
+	}
+
+	//  PairType  _args   ,      ( multi  - ).
+	//          true,   
+	template<typename... Args>
+	std::pair<IteratorType, bool> emplace(Args&&... _args)
+	{
+		//     ,        
+		PairType pair(std::forward<Args>(_args)...);
+		std::pair<NodeType*, bool> res = innerEmplace(pair.first, std::move(pair));
 
-		innerMapPairInsert(*_last);
+		return { IteratorType(this, res.first), res.second };
+	}
+
+	//     _key ,    ,     _args.
+	//  ,      .      true,   
+	template<typename... Args>
+	std::pair<IteratorType, bool> tryEmplace(const KeyType& _key, Args&&... _args)
+	{
+		static_assert(!_Multi, "tryEmplace is not supported by multi containers");
+
+		std::pair<NodeType*, bool> res = innerEmplace(_key, std::piecewise_construct,
+			std::forward_as_tuple(_key), std::forward_as_tuple(std::forward<Args>(_args)...));
+
+		return { IteratorType(this, res.first), res.second };
+	}
+
+	template<typename... Args>
+	std::pair<IteratorType, bool> tryEmplace(KeyType&& _key, Args&&... _args)
+	{
+		static_assert(!_Multi, "tryEmplace is not supported by multi containers");
+
+		std::pair<NodeType*, bool> res = innerEmplace(_key, std::piecewise_construct,
+			std::forward_as_tuple(std::move(_key)), std::forward_as_tuple(std::forward<Args>(_args)...));
+
+		return { IteratorType(this, res.first), res.second };
+	}
+
+	//     _value     .
+	//      true,   
+	template<typename VT>
+	std::pair<IteratorType, bool> insertOrAssign(const KeyType& _key, VT&& _value)
+	{
+		static_assert(!_Multi, "insertOrAssign is not supported by multi containers");
+
+		std::pair<NodeType*, bool> res = innerEmplace(_key, _key, std::forward<VT>(_value));
+
+		//    , _value      
+		if (!res.second)
+			res.first->pair.second = std::forward<VT>(_value);
+
+		return { IteratorType(this, res.first), res.second };
+	}
+
+	template<typename VT>
+	std::pair<IteratorType, bool> insertOrAssign(KeyType&& _key, VT&& _value)
+	{
+		static_assert(!_Multi, "insertOrAssign is not supported by multi containers");
+
+		std::pair<NodeType*, bool> res = innerEmplace(_key, std::move(_key), std::forward<VT>(_value));
+
+		if (!res.second)
+			res.first->pair.second = std::forward<VT>(_value);
+
+		return { IteratorType(this, res.first), res.second };
+	}
+
+	//        _key,      ,   
+	ValueType& operator[](const KeyType& _key)
+	{
+		return tryEmplace(_key).first->second;
+	}
+
+	ValueType& operator[](KeyType&& _key)
+	{
+		return tryEmplace(std::move(_key)).first->second;
+	}
+
+	//      [_first, _last)   :    ,
+	// begin/back     .  _options.uniqueKeys   
+	template<typename InputIterator>
+	void build(InputIterator _first, InputIterator _last, const BHT_NAMESPACE::BuildOptions& _options = BHT_NAMESPACE::BuildOptions())
+	{
+		innerBuild(_first, _last, _options, [](const auto& _pair) -> const KeyType& { return _pair.first; });
 	}
 
 	//Erasing----------------------------------------------------------------------------------------------------------------------------------
 
 	size_t erase(const KeyType& _key)
 	{
-		NodeType* res = innerFind(_key, hasher(_key));
+		size_t count = innerEraseKey(_key);
+		checkShrink();
 
-		if (res == endPtr)
-			return 0;
+		return count;
+	}
+
+	//  (Hasher  EqualComp  is_transparent),  KeyType  
+	template<typename K, typename = BHT_NAMESPACE::EnableTransparentLookup<HasherType, EqualCompType, K>>
+	size_t erase(const K& _key)
+	{
+		size_t count = innerEraseKey(_key);
+		checkShrink();
 
-		return eraseSingleNode(res);
+		return count;
 	}
 
 	size_t erase(IteratorType _iter)
@@ -187,7 +355,10 @@ public:
 		if (!_iter.isValid())
 			return 0;
 
-		return eraseSingleNode(_iter.node);
+		size_t count = eraseSingleNode(_iter.node);
+		checkShrink();
+
+		return count;
 	}
 
 	size_t erase(IteratorType _first, IteratorType _last)
@@ -206,7 +377,12 @@ public:
 			count += eraseSingleNode(temp.node);
 		}
 
-		return count + eraseSingleNode(_last.node);
+		count += eraseSingleNode(_last.node);
+
+		//       , .      
+		checkShrink();
+
+		return count;
 	}
 
 	//Search------------------------------------------------------------------------------------------------------------------------------------
@@ -221,6 +397,41 @@ public:
 		return ConstIteratorType(this, innerFind(_key, hasher(_key)));
 	}
 
+	//  (Hasher  EqualComp  is_transparent),  KeyType  
+	template<typename K, typename = BHT_NAMESPACE::EnableTransparentLookup<HasherType, EqualCompType, K>>
+	IteratorType find(const K& _key) noexcept
+	{
+		return IteratorType(this, innerFind(_key, hasher(_key)));
+	}
+
+	template<typename K, typename = BHT_NAMESPACE::EnableTransparentLookup<HasherType, EqualCompType, K>>
+	ConstIteratorType find(const K& _key) const noexcept
+	{
+		return ConstIteratorType(this, innerFind(_key, hasher(_key)));
+	}
+
+	//  _count ,       _out(   - end()).
+	//      ,       find
+	template<typename OutputIterator>
+	void findBatch(const KeyType* _keys, size_t _count, OutputIterator _out)
+	{
+		innerFindBatch(_keys, _count, [this, &_out](NodeType* _node)
+			{
+				*_out = IteratorType(this, _node);
+				++_out;
+			});
+	}
+
+	template<typename OutputIterator>
+	void findBatch(const KeyType* _keys, size_t _count, OutputIterator _out) const
+	{
+		innerFindBatch(_keys, _count, [this, &_out](NodeType* _node)
+			{
+				*_out = ConstIteratorType(this, _node);
+				++_out;
+			});
+	}
+
 	std::pair<IteratorType, IteratorType> equalRange(const KeyType& _key) noexcept
 	{
 		NodeType* first = nullptr;
@@ -241,6 +452,100 @@ public:
 		return { ConstIteratorType(this, first), ConstIteratorType(this, last) };
 	}
 
+	template<typename K, typename = BHT_NAMESPACE::EnableTransparentLookup<HasherType, EqualCompType, K>>
+	std::pair<IteratorType, IteratorType> equalRange(const K& _key) noexcept
+	{
+		NodeType* first = nullptr;
+		NodeType* last = nullptr;
+
+		markEqualRange(_key, first, last);
+
+		return { IteratorType(this, first), IteratorType(this, last) };
+	}
+
+	template<typename K, typename = BHT_NAMESPACE::EnableTransparentLookup<HasherType, EqualCompType, K>>
+	std::pair<ConstIteratorType, ConstIteratorType> equalRange(const K& _key) const noexcept
+	{
+		NodeType* first = nullptr;
+		NodeType* last = nullptr;
+
+		markEqualRange(_key, first, last);
+
+		return { ConstIteratorType(this, first), ConstIteratorType(this, last) };
+	}
+
+	//Parallel Visiting-------------------------------------------------------------------------------------------------------------------------
+
+	//  _func(const KeyType&, ValueType&)     _threadCount (0 -   ).
+	//     ,      . _func  
+	//   ,        
+	template<typename Func>
+	void parallelForEach(Func _func, size_t _threadCount = 0)
+	{
+		BHT_NAMESPACE::parallelForChunks(visitUnitCount(), _threadCount, [this, &_func](size_t, size_t _first, size_t _last)
+			{
+				forEachNodeInUnits(_first, _last, [&_func](NodeType* _node)
+					{
+						_func(static_cast<const KeyType&>(_node->pair.first), _node->pair.second);
+					});
+			});
+	}
+
+	//  _func(const KeyType&, const ValueType&)
+	template<typename Func>
+	void parallelForEach(Func _func, size_t _threadCount = 0) const
+	{
+		BHT_NAMESPACE::parallelForChunks(visitUnitCount(), _threadCount, [this, &_func](size_t, size_t _first, size_t _last)
+			{
+				forEachNodeInUnits(_first, _last, [&_func](const NodeType* _node) { _func(_node->pair.first, _node->pair.second); });
+			});
+	}
+
+	//  _map(const KeyType&, const ValueType&)     _combine(T, T) -> T,   _init.
+	//      ,  _combine     
+	template<typename T, typename Map, typename Combine>
+	T parallelReduce(T _init, Map _map, Combine _combine, size_t _threadCount = 0) const
+	{
+		return BHT_NAMESPACE::parallelReduceChunks(visitUnitCount(), _threadCount, std::move(_init), _combine,
+			[this, &_map, &_combine](size_t _first, size_t _last, BHT_NAMESPACE::ParallelPartial<T>& _partial)
+			{
+				forEachNodeInUnits(_first, _last, [&](const NodeType* _node)
+					{
+						_partial.add(_map(_node->pair.first, _node->pair.second), _combine);
+					});
+			});
+	}
+
+	//Snapshot----------------------------------------------------------------------------------------------------------------------------------
+
+	//      _path,     MappedHashMap(MappedHashMap.h)
+	//    Hasher. KeyType  ValueType    .  false   
+	bool saveSnapshot(const std::string& _path) const
+	{
+		static_assert(!_Multi, "saveSnapshot is not supported by multi containers");
+
+		return BHM_NAMESPACE::writeSnapshot<KeyType, ValueType, PairType>(_path, BasicHashTable::size(), hasher, [this](auto _func)
+			{
+				forEachNodeInUnits(0, visitUnitCount(), [&_func](const NodeType* _node) { _func(_node->pair); });
+			});
+	}
+
+	//Freezing----------------------------------------------------------------------------------------------------------------------------------
+
+	//     FrozenHashMap(FrozenHashMap.h)    -:
+	//    -       .    
+	FrozenHashMap<KeyType, ValueType, HasherType, EqualCompType> freeze() const
+	{
+		static_assert(!_Multi, "freeze is not supported by multi containers");
+
+		std::vector<PairType> pairs;
+		pairs.reserve(BasicHashTable::size());
+
+		forEachNodeInUnits(0, visitUnitCount(), [&pairs](const NodeType* _node) { pairs.push_back(_node->pair); });
+
+		return FrozenHashMap<KeyType, ValueType, HasherType, EqualCompType>(std::move(pairs));
+	}
+
 	//Iterator----------------------------------------------------------------------------------------------------------------------------------
 
 	IteratorType begin() noexcept
@@ -305,10 +610,12 @@ public:
 };
 
 
-template<typename KeyType, typename ValueType, typename Hasher = std::hash<KeyType>, typename EqualComp = std::equal_to<KeyType>>
-class HashMap : public BHM_NAMESPACE::BasicHashMap<false, BHM_NAMESPACE::HashMapNode<KeyType, ValueType>, Hasher, EqualComp>
+template<typename KeyType, typename ValueType, typename Hasher = std::hash<KeyType>, typename EqualComp = std::equal_to<KeyType>,
+	typename Storage = BHT_NAMESPACE::ChainedStorage, typename Allocator = std::allocator<std::pair<const KeyType, ValueType>>>
+class HashMap : public BHM_NAMESPACE::BasicHashMap<false, BHM_NAMESPACE::HashMapNodeFor<Storage, KeyType, ValueType>, Hasher, EqualComp, Storage, Allocator>
 {
-	using BasicMap = BHM_NAMESPACE::BasicHashMap<false, BHM_NAMESPACE::HashMapNode<KeyType, ValueType>, Hasher, EqualComp>;
+	using BasicMap = BHM_NAMESPACE::BasicHashMap<false, BHM_NAMESPACE::HashMapNodeFor<Storage, KeyType, ValueType>, Hasher, EqualComp, Storage,
+		Allocator>;
 
 //Public Methods--------------------------------------------------------------------------------------------------------------------------------
 public:
@@ -319,23 +626,31 @@ public:
 
 	HashMap() : BasicMap() {};
 
-	HashMap(size_t _bucketCount) : BasicMap(_bucketCount) {};
+	explicit HashMap(const Allocator& _allocator) : BasicMap(_allocator) {};
+
+	HashMap(size_t _bucketCount, const Allocator& _allocator = Allocator()) : BasicMap(_bucketCount, _allocator) {};
 
-	HashMap(size_t _bucketCount, std::initializer_list<PairType>& _initList) : BasicMap(_bucketCount, _initList) {};
+	HashMap(size_t _bucketCount, std::initializer_list<PairType>& _initList, const Allocator& _allocator = Allocator()) :
+		BasicMap(_bucketCount, _initList, _allocator) {};
 
 	template<typename InputIterator>
-	HashMap(size_t _bucketCount, InputIterator _first, InputIterator _last) : BasicMap(_bucketCount, _first, _last) {};
+	HashMap(size_t _bucketCount, InputIterator _first, InputIterator _last, const Allocator& _allocator = Allocator()) :
+		BasicMap(_bucketCount, _first, _last, _allocator) {};
 
 	HashMap(const HashMap& _other) : BasicMap(_other) {};
 
+	HashMap(const HashMap& _other, const Allocator& _allocator) : BasicMap(_other, _allocator) {};
+
 	HashMap(HashMap&& _other) noexcept : BasicMap(std::move(_other)) {};
 };
 
 
-template<typename KeyType, typename ValueType, typename Hasher = std::hash<KeyType>, typename EqualComp = std::equal_to<KeyType>>
-class HashMultiMap : public BHM_NAMESPACE::BasicHashMap<true, BHM_NAMESPACE::HashMapNode<KeyType, ValueType>, Hasher, EqualComp>
+template<typename KeyType, typename ValueType, typename Hasher = std::hash<KeyType>, typename EqualComp = std::equal_to<KeyType>,
+	typename Storage = BHT_NAMESPACE::ChainedStorage, typename Allocator = std::allocator<std::pair<const KeyType, ValueType>>>
+class HashMultiMap : public BHM_NAMESPACE::BasicHashMap<true, BHM_NAMESPACE::HashMapNodeFor<Storage, KeyType, ValueType>, Hasher, EqualComp, Storage, Allocator>
 {
-	using BasicMap = BHM_NAMESPACE::BasicHashMap<true, BHM_NAMESPACE::HashMapNode<KeyType, ValueType>, Hasher, EqualComp>;
+	using BasicMap = BHM_NAMESPACE::BasicHashMap<true, BHM_NAMESPACE::HashMapNodeFor<Storage, KeyType, ValueType>, Hasher, EqualComp, Storage,
+		Allocator>;
 
 //Public Methods--------------------------------------------------------------------------------------------------------------------------------
 public:
@@ -345,19 +660,63 @@ public:
 	//Constructors------------------------------------------------------------------------------------------------------------------------------
 	HashMultiMap() : BasicMap() {};
 
-	HashMultiMap(size_t _bucketCount) : BasicMap(_bucketCount) {};
+	explicit HashMultiMap(const Allocator& _allocator) : BasicMap(_allocator) {};
 
-	HashMultiMap(size_t _bucketCount, std::initializer_list<PairType>& _initList) : BasicMap(_bucketCount, _initList) {};
+	HashMultiMap(size_t _bucketCount, const Allocator& _allocator = Allocator()) : BasicMap(_bucketCount, _allocator) {};
+
+	HashMultiMap(size_t _bucketCount, std::initializer_list<PairType>& _initList, const Allocator& _allocator = Allocator()) :
+		BasicMap(_bucketCount, _initList, _allocator) {};
 
 	template<typename InputIterator>
-	HashMultiMap(size_t _bucketCount, InputIterator _first, InputIterator _last) : BasicMap(_bucketCount, _first, _last) {};
+	HashMultiMap(size_t _bucketCount, InputIterator _first, InputIterator _last, const Allocator& _allocator = Allocator()) :
+		BasicMap(_bucketCount, _first, _last, _allocator) {};
 
 	HashMultiMap(const HashMultiMap& _other) : BasicMap(_other) {};
 
+	HashMultiMap(const HashMultiMap& _other, const Allocator& _allocator) : BasicMap(_other, _allocator) {};
+
 	HashMultiMap(HashMultiMap&& _other) noexcept : BasicMap(std::move(_other)) {};
 };
 
 
+template<typename KeyType, typename ValueType, typename Hasher = std::hash<KeyType>, typename EqualComp = std::equal_to<KeyType>,
+	typename Allocator = std::allocator<std::pair<const KeyType, ValueType>>>
+using SwissHashMap = HashMap<KeyType, ValueType, Hasher, EqualComp, BHT_NAMESPACE::SwissStorage, Allocator>;
+
+template<typename KeyType, typename ValueType, typename Hasher = std::hash<KeyType>, typename EqualComp = std::equal_to<KeyType>,
+	typename Allocator = std::allocator<std::pair<const KeyType, ValueType>>>
+using OrderedHashMap = HashMap<KeyType, ValueType, Hasher, EqualComp, BHT_NAMESPACE::OrderedStorage, Allocator>;
+
+
+#if __has_include(<memory_resource>)
+//   std::pmr::polymorphic_allocator:    std::pmr::memory_resource,   
+// (, std::pmr::monotonic_buffer_resource,       )
+namespace BHM_NAMESPACE
+{
+	namespace pmr
+	{
+		template<typename KeyType, typename ValueType, typename Hasher = std::hash<KeyType>, typename EqualComp = std::equal_to<KeyType>,
+			typename Storage = BHT_NAMESPACE::ChainedStorage>
+		using HashMap = ::HashMap<KeyType, ValueType, Hasher, EqualComp, Storage,
+			std::pmr::polymorphic_allocator<std::pair<const KeyType, ValueType>>>;
+
+		template<typename KeyType, typename ValueType, typename Hasher = std::hash<KeyType>, typename EqualComp = std::equal_to<KeyType>,
+			typename Storage = BHT_NAMESPACE::ChainedStorage>
+		using HashMultiMap = ::HashMultiMap<KeyType, ValueType, Hasher, EqualComp, Storage,
+			std::pmr::polymorphic_allocator<std::pair<const KeyType, ValueType>>>;
+
+		template<typename KeyType, typename ValueType, typename Hasher = std::hash<KeyType>, typename EqualComp = std::equal_to<KeyType>>
+		using SwissHashMap = ::SwissHashMap<KeyType, ValueType, Hasher, EqualComp,
+			std::pmr::polymorphic_allocator<std::pair<const KeyType, ValueType>>>;
+
+		template<typename KeyType, typename ValueType, typename Hasher = std::hash<KeyType>, typename EqualComp = std::equal_to<KeyType>>
+		using OrderedHashMap = ::OrderedHashMap<KeyType, ValueType, Hasher, EqualComp,
+			std::pmr::polymorphic_allocator<std::pair<const KeyType, ValueType>>>;
+	}
+}
+#endif
+
+
 template<typename HashTable>
 class HashMapIterator : public BD_ITER_NAMESPACE::MapIterator<HashTable>
 {
@@ -367,8 +726,10 @@ class HashMapIterator : public BD_ITER_NAMESPACE::MapIterator<HashTable>
 	using BasicIter::cont;
 	using BasicIter::node;
 
-	friend class BHM_NAMESPACE::BasicHashMap<false, NodeType, typename HashTable::HasherType, typename HashTable::EqualCompType>; //  HashMap
-	friend class BHM_NAMESPACE::BasicHashMap<true, NodeType, typename HashTable::HasherType, typename HashTable::EqualCompType>; //  HashMultiMap
+	friend class BHM_NAMESPACE::BasicHashMap<false, NodeType, typename HashTable::HasherType, typename HashTable::EqualCompType, typename HashTable::StorageType,
+		typename HashTable::AllocatorType>; //  HashMap
+	friend class BHM_NAMESPACE::BasicHashMap<true, NodeType, typename HashTable::HasherType, typename HashTable::EqualCompType, typename HashTable::StorageType,
+		typename HashTable::AllocatorType>; //  HashMultiMap
 
 public:
 
@@ -418,8 +779,10 @@ class ConstHashMapIterator : public BD_ITER_NAMESPACE::ConstMapIterator<HashTabl
 	using BasicIter::cont;
 	using BasicIter::node;
 
-	friend class BHM_NAMESPACE::BasicHashMap<false, NodeType, typename HashTable::HasherType, typename HashTable::EqualCompType>; //  HashMap
-	friend class BHM_NAMESPACE::BasicHashMap<true, NodeType, typename HashTable::HasherType, typename HashTable::EqualCompType>; //  HashMultiMap
+	friend class BHM_NAMESPACE::BasicHashMap<false, NodeType, typename HashTable::HasherType, typename HashTable::EqualCompType, typename HashTable::StorageType,
+		typename HashTable::AllocatorType>; //  HashMap
+	friend class BHM_NAMESPACE::BasicHashMap<true, NodeType, typename HashTable::HasherType, typename HashTable::EqualCompType, typename HashTable::StorageType,
+		typename HashTable::AllocatorType>; //  HashMultiMap
 
 public:
 
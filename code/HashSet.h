@@ -1,44 +1,82 @@
 #ifndef _HASH_SET_H_
 #define _HASH_SET_H_
 
+#if __has_include(<memory_resource>)
+#include <memory_resource>
+#endif
+
 #include "HashTableBasic.h"
+#include "SwissTableBasic.h"
+#include "OrderedTableBasic.h"
 #include "BiderectionalIterators.h"
+#include "FrozenHashSet.h"
 
 template<typename HashTable>
 class HashSetIterator;
 
 namespace BHS_NAMESPACE
 {
-	template<typename _KeyType>
+	template<typename _KeyType, typename _NodeHash, typename _ChainLinks>
 	struct HashSetNode;
 
-	template<bool _Multi, typename _NodeType, typename _Hasher, typename _EqualComp>
+	template<typename _KeyType>
+	struct HashSetSlot;
+
+	//  ,     
+	template<typename _Storage, typename _KeyType>
+	using HashSetNodeFor = typename std::conditional<_Storage::isFlat, HashSetSlot<_KeyType>,
+		HashSetNode<_KeyType, typename BHT_NAMESPACE::StorageNodeHash<_Storage>::type,
+			typename BHT_NAMESPACE::StorageChainLinks<_Storage>::type>>::type;
+
+	template<bool _Multi, typename _NodeType, typename _Hasher, typename _EqualComp, typename _Storage, typename _Allocator>
 	class BasicHashSet;
 }
 
-template<typename _KeyType>
-struct BHS_NAMESPACE::HashSetNode
+//       _ChainLinks::Links(DoublyLinkedChain, SinglyLinkedChain),
+// (  ) -    _NodeHash(FullNodeHash, TagNodeHash, NoNodeHash).
+//   ,  32-      
+template<typename _KeyType, typename _NodeHash, typename _ChainLinks>
+struct BHS_NAMESPACE::HashSetNode : _ChainLinks::template Links<HashSetNode<_KeyType, _NodeHash, _ChainLinks>>, _NodeHash
 {
 	using KeyType = _KeyType;
+	using PayloadType = KeyType;
 
-	const size_t hash;
 	const KeyType key;
-	HashSetNode* prev = nullptr;
-	HashSetNode* next = nullptr;
 
 	template<typename KT>
 	HashSetNode(size_t _hash, KT&& _key) :
-		hash(_hash), key(std::forward<KT>(_key)) {};
+		_NodeHash(_hash), key(std::forward<KT>(_key)) {};
 
 	HashSetNode(HashSetNode* _other) :
-		hash(_other->hash), key(_other->key) {};
+		_NodeHash(*_other), key(_other->key) {};
+
+	const KeyType& getKey() const noexcept { return key; }
+};
+
+
+template<typename _KeyType>
+struct BHS_NAMESPACE::HashSetSlot
+{
+	using KeyType = _KeyType;
+	using PayloadType = KeyType;
+
+	KeyType key; //  const,      ,   
+
+	//     ,      HashSetNode
+	template<typename KT>
+	HashSetSlot(size_t, KT&& _key) :
+		key(std::forward<KT>(_key)) {};
+
+	HashSetSlot(HashSetSlot* _other) :
+		key(_other->key) {};
 
 	const KeyType& getKey() const noexcept { return key; }
 };
 
 
-template<bool _Multi, typename _NodeType, typename _Hasher, typename _EqualComp>
-class BHS_NAMESPACE::BasicHashSet : public BHT_NAMESPACE::HashTable<_Multi, _NodeType, _Hasher, _EqualComp>
+// _Allocator   ,     rebind'    
+template<bool _Multi, typename _NodeType, typename _Hasher, typename _EqualComp, typename _Storage, typename _Allocator>
+class BHS_NAMESPACE::BasicHashSet : public _Storage::template Table<_Multi, _NodeType, _Hasher, _EqualComp, _Allocator>
 {
 //Public Types----------------------------------------------------------------------------------------------------------------------------------
 public:
@@ -46,17 +84,26 @@ public:
 	using KeyType = typename _NodeType::KeyType;
 	using HasherType = _Hasher;
 	using EqualCompType = _EqualComp;
+	using StorageType = _Storage;
+	using AllocatorType = _Allocator;
 	using IteratorType = HashSetIterator<BasicHashSet>;
 
 //Private Types & Usings------------------------------------------------------------------------------------------------------------------------
 private:
 	using NodeType = _NodeType;
-	using BasicHashTable = BHT_NAMESPACE::HashTable<_Multi, NodeType, HasherType, EqualCompType>;
+	using BasicHashTable = typename StorageType::template Table<_Multi, NodeType, HasherType, EqualCompType, AllocatorType>;
+	using AllocatorTraits = std::allocator_traits<AllocatorType>;
 	using BasicHashTable::hasher;
 	using BasicHashTable::bucketCount;
 	using BasicHashTable::innerSetInsert;
 	using BasicHashTable::eraseSingleNode;
+	using BasicHashTable::innerEraseKey;
+	using BasicHashTable::checkShrink;
 	using BasicHashTable::innerFind;
+	using BasicHashTable::innerFindBatch;
+	using BasicHashTable::innerBuild;
+	using BasicHashTable::visitUnitCount;
+	using BasicHashTable::forEachNodeInUnits;
 	using BasicHashTable::markEqualRange;
 	using BasicHashTable::copyConstruct;
 	using BasicHashTable::moveConstruct;
@@ -66,7 +113,7 @@ private:
 	using BasicHashTable::endPtr;
 
 	friend class BD_ITER_NAMESPACE::BDIterator<BasicHashSet>;
-	friend class IteratorType;
+	friend IteratorType;
 
 //Protected Methods-----------------------------------------------------------------------------------------------------------------------------
 protected:
@@ -75,25 +122,36 @@ protected:
 
 	BasicHashSet() : BasicHashTable() {};
 
-	BasicHashSet(size_t _bucketCount) : BasicHashTable(_bucketCount) {};
+	explicit BasicHashSet(const AllocatorType& _allocator) : BasicHashTable(_allocator) {};
 
-	BasicHashSet(size_t _bucketCount, std::initializer_list<KeyType> _initList) : BasicHashTable(_bucketCount)
+	BasicHashSet(size_t _bucketCount, const AllocatorType& _allocator = AllocatorType()) : BasicHashTable(_bucketCount, _allocator) {};
+
+	BasicHashSet(size_t _bucketCount, std::initializer_list<KeyType> _initList, const AllocatorType& _allocator = AllocatorType()) :
+		BasicHashTable(_bucketCount, _allocator)
 	{
 		insert(_initList);
 	}
 
 	template<typename InputIterator>
-	BasicHashSet(size_t _bucketCount, InputIterator _first, InputIterator _last) : BasicHashTable(_bucketCount)
+	BasicHashSet(size_t _bucketCount, InputIterator _first, InputIterator _last, const AllocatorType& _allocator = AllocatorType()) :
+		BasicHashTable(_bucketCount, _allocator)
 	{
 		insert(_first, _last);
 	}
 
-	BasicHashSet(const BasicHashSet& _other) : BasicHashTable()
+	//    select_on_container_copy_construction,   BasicHashMap
+	BasicHashSet(const BasicHashSet& _other) :
+		BasicHashTable(AllocatorTraits::select_on_container_copy_construction(_other.getAllocator()))
+	{
+		copyConstruct(_other);
+	}
+
+	BasicHashSet(const BasicHashSet& _other, const AllocatorType& _allocator) : BasicHashTable(_allocator)
 	{
 		copyConstruct(_other);
 	}
 
-	BasicHashSet(BasicHashSet&& _other) noexcept : BasicHashTable()
+	BasicHashSet(BasicHashSet&& _other) noexcept : BasicHashTable(_other.getAllocator())
 	{
 		moveConstruct(_other);
 	}
@@ -127,20 +185,34 @@ public:
 			innerSetInsert(*_first);
 			++_first;
 		}
+	}
 
-		innerSetInsert(*_last);
+	//      [_first, _last)   :    ,
+	// begin/back     .  _options.uniqueKeys   
+	template<typename InputIterator>
+	void build(InputIterator _first, InputIterator _last, const BHT_NAMESPACE::BuildOptions& _options = BHT_NAMESPACE::BuildOptions())
+	{
+		innerBuild(_first, _last, _options, [](const KeyType& _key) -> const KeyType& { return _key; });
 	}
 
 	//Erasing-----------------------------------------------------------------------------------------------------------------------------------
 
 	size_t erase(const KeyType& _key) 
 	{
-		NodeType* res = innerFind(_key, hasher(_key));
+		size_t count = innerEraseKey(_key);
+		checkShrink();
 
-		if (res == endPtr)
-			return 0;
+		return count;
+	}
+
+	//  (Hasher  EqualComp  is_transparent),  KeyType  
+	template<typename K, typename = BHT_NAMESPACE::EnableTransparentLookup<HasherType, EqualCompType, K>>
+	size_t erase(const K& _key)
+	{
+		size_t count = innerEraseKey(_key);
+		checkShrink();
 
-		return eraseSingleNode(res);
+		return count;
 	}
 
 	size_t erase(IteratorType _iter) 
@@ -148,7 +220,10 @@ public:
 		if (!_iter.isValid())
 			return 0;
 
-		return eraseSingleNode(_iter.node);
+		size_t count = eraseSingleNode(_iter.node);
+		checkShrink();
+
+		return count;
 	}
 
 	size_t erase(IteratorType _first, IteratorType _last)
@@ -167,7 +242,12 @@ public:
 			count += eraseSingleNode(temp.node);
 		}
 
-		return count + eraseSingleNode(_last.node);
+		count += eraseSingleNode(_last.node);
+
+		//       , .      
+		checkShrink();
+
+		return count;
 	}
 
 	//Search------------------------------------------------------------------------------------------------------------------------------------
@@ -177,6 +257,25 @@ public:
 		return IteratorType(this, innerFind(_key, hasher(_key)));
 	}
 
+	//  (Hasher  EqualComp  is_transparent),  KeyType  
+	template<typename K, typename = BHT_NAMESPACE::EnableTransparentLookup<HasherType, EqualCompType, K>>
+	IteratorType find(const K& _key) const noexcept
+	{
+		return IteratorType(this, innerFind(_key, hasher(_key)));
+	}
+
+	//  _count ,       _out(   - end()).
+	//      ,       find
+	template<typename OutputIterator>
+	void findBatch(const KeyType* _keys, size_t _count, OutputIterator _out) const
+	{
+		innerFindBatch(_keys, _count, [this, &_out](NodeType* _node)
+			{
+				*_out = IteratorType(this, _node);
+				++_out;
+			});
+	}
+
 	std::pair<IteratorType, IteratorType> equalRange(const KeyType& _key) const noexcept
 	{
 		NodeType* first = nullptr;
@@ -187,6 +286,59 @@ public:
 		return { IteratorType(this, first), IteratorType(this, last) };
 	}
 
+	template<typename K, typename = BHT_NAMESPACE::EnableTransparentLookup<HasherType, EqualCompType, K>>
+	std::pair<IteratorType, IteratorType> equalRange(const K& _key) const noexcept
+	{
+		NodeType* first = nullptr;
+		NodeType* last = nullptr;
+
+		markEqualRange(_key, first, last);
+
+		return { IteratorType(this, first), IteratorType(this, last) };
+	}
+
+	//Parallel Visiting-------------------------------------------------------------------------------------------------------------------------
+
+	//  _func(const KeyType&)     _threadCount (0 -   ).
+	//     ,      . _func  ,
+	//      
+	template<typename Func>
+	void parallelForEach(Func _func, size_t _threadCount = 0) const
+	{
+		BHT_NAMESPACE::parallelForChunks(visitUnitCount(), _threadCount, [this, &_func](size_t, size_t _first, size_t _last)
+			{
+				forEachNodeInUnits(_first, _last, [&_func](NodeType* _node) { _func(_node->getKey()); });
+			});
+	}
+
+	//  _map(const KeyType&)     _combine(T, T) -> T,   _init.
+	//      ,  _combine     
+	template<typename T, typename Map, typename Combine>
+	T parallelReduce(T _init, Map _map, Combine _combine, size_t _threadCount = 0) const
+	{
+		return BHT_NAMESPACE::parallelReduceChunks(visitUnitCount(), _threadCount, std::move(_init), _combine,
+			[this, &_map, &_combine](size_t _first, size_t _last, BHT_NAMESPACE::ParallelPartial<T>& _partial)
+			{
+				forEachNodeInUnits(_first, _last, [&](NodeType* _node) { _partial.add(_map(_node->getKey()), _combine); });
+			});
+	}
+
+	//Freezing----------------------------------------------------------------------------------------------------------------------------------
+
+	//     FrozenHashSet(FrozenHashSet.h)    -.
+	//    
+	FrozenHashSet<KeyType, HasherType, EqualCompType> freeze() const
+	{
+		static_assert(!_Multi, "freeze is not supported by multi containers");
+
+		std::vector<KeyType> keys;
+		keys.reserve(BasicHashTable::size());
+
+		forEachNodeInUnits(0, visitUnitCount(), [&keys](const NodeType* _node) { keys.push_back(_node->getKey()); });
+
+		return FrozenHashSet<KeyType, HasherType, EqualCompType>(std::move(keys));
+	}
+
 	//Iterator----------------------------------------------------------------------------------------------------------------------------------
 
 	IteratorType beforeBegin() const noexcept
@@ -211,10 +363,11 @@ public:
 };
 
 
-template<typename KeyType, typename Hasher = std::hash<KeyType>, typename EqualComp = std::equal_to<KeyType>>
-class HashSet : public BHS_NAMESPACE::BasicHashSet<false, BHS_NAMESPACE::HashSetNode<KeyType>, Hasher, EqualComp>
+template<typename KeyType, typename Hasher = std::hash<KeyType>, typename EqualComp = std::equal_to<KeyType>,
+	typename Storage = BHT_NAMESPACE::ChainedStorage, typename Allocator = std::allocator<KeyType>>
+class HashSet : public BHS_NAMESPACE::BasicHashSet<false, BHS_NAMESPACE::HashSetNodeFor<Storage, KeyType>, Hasher, EqualComp, Storage, Allocator>
 {
-	using BasicSet = BHS_NAMESPACE::BasicHashSet<false, BHS_NAMESPACE::HashSetNode<KeyType>, Hasher, EqualComp>;
+	using BasicSet = BHS_NAMESPACE::BasicHashSet<false, BHS_NAMESPACE::HashSetNodeFor<Storage, KeyType>, Hasher, EqualComp, Storage, Allocator>;
 
 //Public Methods--------------------------------------------------------------------------------------------------------------------------------
 public:
@@ -223,23 +376,30 @@ public:
 
 	HashSet() : BasicSet() {};
 
-	HashSet(size_t _bucketCount) : BasicSet(_bucketCount) {};
+	explicit HashSet(const Allocator& _allocator) : BasicSet(_allocator) {};
 
-	HashSet(size_t _bucketCount, std::initializer_list<KeyType>& _initList) : BasicSet(_bucketCount, _initList) {};
+	HashSet(size_t _bucketCount, const Allocator& _allocator = Allocator()) : BasicSet(_bucketCount, _allocator) {};
+
+	HashSet(size_t _bucketCount, std::initializer_list<KeyType>& _initList, const Allocator& _allocator = Allocator()) :
+		BasicSet(_bucketCount, _initList, _allocator) {};
 
 	template<typename InputIterator>
-	HashSet(size_t _bucketCount, InputIterator _first, InputIterator _last) : BasicSet(_bucketCount, _first, _last) {};
+	HashSet(size_t _bucketCount, InputIterator _first, InputIterator _last, const Allocator& _allocator = Allocator()) :
+		BasicSet(_bucketCount, _first, _last, _allocator) {};
 
 	HashSet(const HashSet& _other) : BasicSet(_other) {};
 
+	HashSet(const HashSet& _other, const Allocator& _allocator) : BasicSet(_other, _allocator) {};
+
 	HashSet(HashSet&& _other) noexcept : BasicSet(std::move(_other)) {};
 };
 
 
-template<typename KeyType, typename Hasher = std::hash<KeyType>, typename EqualComp = std::equal_to<KeyType>>
-class HashMultiSet : public BHS_NAMESPACE::BasicHashSet<true, BHS_NAMESPACE::HashSetNode<KeyType>, Hasher, EqualComp>
+template<typename KeyType, typename Hasher = std::hash<KeyType>, typename EqualComp = std::equal_to<KeyType>,
+	typename Storage = BHT_NAMESPACE::ChainedStorage, typename Allocator = std::allocator<KeyType>>
+class HashMultiSet : public BHS_NAMESPACE::BasicHashSet<true, BHS_NAMESPACE::HashSetNodeFor<Storage, KeyType>, Hasher, EqualComp, Storage, Allocator>
 {
-	using BasicSet = BHS_NAMESPACE::BasicHashSet<true, BHS_NAMESPACE::HashSetNode<KeyType>, Hasher, EqualComp>;
+	using BasicSet = BHS_NAMESPACE::BasicHashSet<true, BHS_NAMESPACE::HashSetNodeFor<Storage, KeyType>, Hasher, EqualComp, Storage, Allocator>;
 
 //Public Methods-----------------------------------------------------------------------------------------------------------------------------
 public:
@@ -248,19 +408,58 @@ public:
 
 	HashMultiSet() : BasicSet() {};
 
-	HashMultiSet(size_t _bucketCount) : BasicSet(_bucketCount) {};
+	explicit HashMultiSet(const Allocator& _allocator) : BasicSet(_allocator) {};
 
-	HashMultiSet(size_t _bucketCount, std::initializer_list<KeyType>& _initList) : BasicSet(_bucketCount, _initList) {};
+	HashMultiSet(size_t _bucketCount, const Allocator& _allocator = Allocator()) : BasicSet(_bucketCount, _allocator) {};
+
+	HashMultiSet(size_t _bucketCount, std::initializer_list<KeyType>& _initList, const Allocator& _allocator = Allocator()) :
+		BasicSet(_bucketCount, _initList, _allocator) {};
 
 	template<typename InputIterator>
-	HashMultiSet(size_t _bucketCount, InputIterator _first, InputIterator _last) : BasicSet(_bucketCount, _first, _last) {};
+	HashMultiSet(size_t _bucketCount, InputIterator _first, InputIterator _last, const Allocator& _allocator = Allocator()) :
+		BasicSet(_bucketCount, _first, _last, _allocator) {};
 
 	HashMultiSet(const HashMultiSet& _other) : BasicSet(_other) {};
 
+	HashMultiSet(const HashMultiSet& _other, const Allocator& _allocator) : BasicSet(_other, _allocator) {};
+
 	HashMultiSet(HashMultiSet&& _other) noexcept : BasicSet(std::move(_other)) {};
 };
 
 
+template<typename KeyType, typename Hasher = std::hash<KeyType>, typename EqualComp = std::equal_to<KeyType>,
+	typename Allocator = std::allocator<KeyType>>
+using SwissHashSet = HashSet<KeyType, Hasher, EqualComp, BHT_NAMESPACE::SwissStorage, Allocator>;
+
+template<typename KeyType, typename Hasher = std::hash<KeyType>, typename EqualComp = std::equal_to<KeyType>,
+	typename Allocator = std::allocator<KeyType>>
+using OrderedHashSet = HashSet<KeyType, Hasher, EqualComp, BHT_NAMESPACE::OrderedStorage, Allocator>;
+
+
+#if __has_include(<memory_resource>)
+//   std::pmr::polymorphic_allocator,  BHM_NAMESPACE::pmr::HashMap(HashMap.h)
+namespace BHS_NAMESPACE
+{
+	namespace pmr
+	{
+		template<typename KeyType, typename Hasher = std::hash<KeyType>, typename EqualComp = std::equal_to<KeyType>,
+			typename Storage = BHT_NAMESPACE::ChainedStorage>
+		using HashSet = ::HashSet<KeyType, Hasher, EqualComp, Storage, std::pmr::polymorphic_allocator<KeyType>>;
+
+		template<typename KeyType, typename Hasher = std::hash<KeyType>, typename EqualComp = std::equal_to<KeyType>,
+			typename Storage = BHT_NAMESPACE::ChainedStorage>
+		using HashMultiSet = ::HashMultiSet<KeyType, Hasher, EqualComp, Storage, std::pmr::polymorphic_allocator<KeyType>>;
+
+		template<typename KeyType, typename Hasher = std::hash<KeyType>, typename EqualComp = std::equal_to<KeyType>>
+		using SwissHashSet = ::SwissHashSet<KeyType, Hasher, EqualComp, std::pmr::polymorphic_allocator<KeyType>>;
+
+		template<typename KeyType, typename Hasher = std::hash<KeyType>, typename EqualComp = std::equal_to<KeyType>>
+		using OrderedHashSet = ::OrderedHashSet<KeyType, Hasher, EqualComp, std::pmr::polymorphic_allocator<KeyType>>;
+	}
+}
+#endif
+
+
 template<typename HashTable>
 class HashSetIterator : public BD_ITER_NAMESPACE::SetIterator<HashTable>
 {
@@ -270,8 +469,10 @@ class HashSetIterator : public BD_ITER_NAMESPACE::SetIterator<HashTable>
 	using BasicIter::cont;
 	using BasicIter::node;
 
-	friend class BHS_NAMESPACE::BasicHashSet<false, NodeType, typename HashTable::HasherType, typename HashTable::EqualCompType>; //  HashSet
-	friend class BHS_NAMESPACE::BasicHashSet<true, NodeType, typename HashTable::HasherType, typename HashTable::EqualCompType>; //  HashMultiSet
+	friend class BHS_NAMESPACE::BasicHashSet<false, NodeType, typename HashTable::HasherType, typename HashTable::EqualCompType, typename HashTable::StorageType,
+		typename HashTable::AllocatorType>; //  HashSet
+	friend class BHS_NAMESPACE::BasicHashSet<true, NodeType, typename HashTable::HasherType, typename HashTable::EqualCompType, typename HashTable::StorageType,
+		typename HashTable::AllocatorType>; //  HashMultiSet
 
 public:
 
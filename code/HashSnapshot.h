@@ -0,0 +1,183 @@
+#ifndef _HASH_SNAPSHOT_H_
+#define _HASH_SNAPSHOT_H_
+
+#include <cstdio>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <type_traits>
+
+#include "BucketIndex.h"
+
+//   (     ,       ):
+//  - SnapshotHeader
+//  -  : bucketCount + 1  uint64_t,   i -  [table[i], table[i + 1])
+//  -    elementCount  SnapshotEntry<KeyType, ValueType>,   
+//   - PowerOfTwoIndex   ,         Hasher
+
+namespace BHM_NAMESPACE
+{
+	struct SnapshotHeader
+	{
+		static constexpr char validMagic[8] = { 'B', 'H', 'M', 'S', 'N', 'A', 'P', '\0' };
+		static constexpr uint32_t currentVersion = 1;
+		static constexpr uint32_t validByteOrderMark = 0x01020304u;
+
+		char magic[8];
+		uint32_t version;
+		uint32_t byteOrderMark;   //      
+		uint32_t keySize;
+		uint32_t valueSize;
+		uint32_t entrySize;
+		uint32_t entryAlign;
+		uint64_t elementCount;
+		uint64_t bucketCount;       //  
+		uint64_t bucketTableOffset;
+		uint64_t entryOffset;
+		uint64_t fileSize;
+	};
+
+	//  ,     std::pair,       HashMap
+	template<typename KeyType, typename ValueType>
+	struct SnapshotEntry
+	{
+		KeyType first;
+		ValueType second;
+	};
+
+	template<typename KeyType, typename ValueType>
+	constexpr bool isSnapshotCompatible = std::is_trivially_copyable<KeyType>::value && std::is_trivially_copyable<ValueType>::value;
+
+
+	// ,    _align( )
+	inline uint64_t alignSnapshotOffset(uint64_t _offset, uint64_t _align) noexcept
+	{
+		return (_offset + _align - 1) & ~(_align - 1);
+	}
+
+	//    _elementCount  SnapshotEntry<KeyType, ValueType>      
+	template<typename KeyType, typename ValueType>
+	SnapshotHeader makeSnapshotHeader(size_t _elementCount) noexcept
+	{
+		using Entry = SnapshotEntry<KeyType, ValueType>;
+
+		SnapshotHeader header;
+		std::memset(&header, 0, sizeof(header));
+		std::memcpy(header.magic, SnapshotHeader::validMagic, sizeof(header.magic));
+
+		header.version = SnapshotHeader::currentVersion;
+		header.byteOrderMark = SnapshotHeader::validByteOrderMark;
+		header.keySize = sizeof(KeyType);
+		header.valueSize = sizeof(ValueType);
+		header.entrySize = sizeof(Entry);
+		header.entryAlign = alignof(Entry) > 8 ? alignof(Entry) : 8;
+		header.elementCount = _elementCount;
+		header.bucketCount = BHT_NAMESPACE::PowerOfTwoIndex::roundBucketCount(_elementCount);
+		header.bucketTableOffset = alignSnapshotOffset(sizeof(SnapshotHeader), 8);
+		header.entryOffset = alignSnapshotOffset(header.bucketTableOffset + (header.bucketCount + 1) * sizeof(uint64_t), header.entryAlign);
+		header.fileSize = header.entryOffset + _elementCount * sizeof(Entry);
+
+		return header;
+	}
+
+	// ,      SnapshotEntry<KeyType, ValueType>       
+	//          _fileSize
+	template<typename KeyType, typename ValueType>
+	bool isValidSnapshotHeader(const SnapshotHeader& _header, uint64_t _fileSize) noexcept
+	{
+		SnapshotHeader expected = makeSnapshotHeader<KeyType, ValueType>(static_cast<size_t>(_header.elementCount));
+
+		return std::memcmp(_header.magic, SnapshotHeader::validMagic, sizeof(_header.magic)) == 0 &&
+			_header.version == expected.version && _header.byteOrderMark == expected.byteOrderMark &&
+			_header.keySize == expected.keySize && _header.valueSize == expected.valueSize &&
+			_header.entrySize == expected.entrySize && _header.entryAlign == expected.entryAlign &&
+			_header.bucketCount == expected.bucketCount && _header.bucketTableOffset == expected.bucketTableOffset &&
+			_header.entryOffset == expected.entryOffset && _header.fileSize == expected.fileSize && _header.fileSize <= _fileSize;
+	}
+
+
+	//    _elementCount    _path. _forEach(func)   func(const PairType&)   
+	// (  ),            .
+	//   ,   -       8   .
+	//  false,     
+	template<typename KeyType, typename ValueType, typename PairType, typename Hasher, typename ForEach>
+	bool writeSnapshot(const std::string& _path, size_t _elementCount, const Hasher& _hasher, ForEach _forEach)
+	{
+		static_assert(isSnapshotCompatible<KeyType, ValueType>, "Snapshot requires trivially copyable KeyType and ValueType");
+
+		using Entry = SnapshotEntry<KeyType, ValueType>;
+
+		SnapshotHeader header = makeSnapshotHeader<KeyType, ValueType>(_elementCount);
+
+		BHT_NAMESPACE::PowerOfTwoIndex bucketIndex;
+		bucketIndex.setBucketCount(static_cast<size_t>(header.bucketCount));
+
+		//  :  ,   
+		std::vector<uint64_t> bucketTable(static_cast<size_t>(header.bucketCount) + 1, 0);
+
+		_forEach([&](const PairType& _pair)
+			{
+				++bucketTable[bucketIndex.index(_hasher(_pair.first)) + 1];
+			});
+
+		for (size_t i = 1; i < bucketTable.size(); ++i)
+			bucketTable[i] += bucketTable[i - 1];
+
+		if (bucketTable.back() != _elementCount)
+			return false;
+
+		//  :    
+		std::vector<const PairType*> order(_elementCount);
+		std::vector<uint64_t> cursors(bucketTable.begin(), bucketTable.end() - 1);
+
+		_forEach([&](const PairType& _pair)
+			{
+				order[static_cast<size_t>(cursors[bucketIndex.index(_hasher(_pair.first))]++)] = &_pair;
+			});
+
+		std::FILE* file = std::fopen(_path.c_str(), "wb");
+		if (!file)
+			return false;
+
+		bool isWritten = std::fwrite(&header, sizeof(header), 1, file) == 1;
+
+		//  ( entryAlign)       ,
+		//        
+		const size_t chunkEntries = 4096;
+		std::vector<char> buffer(chunkEntries * sizeof(Entry) + header.entryAlign, 0);
+
+		size_t gap = static_cast<size_t>(header.bucketTableOffset) - sizeof(header);
+		isWritten = isWritten && (gap == 0 || std::fwrite(buffer.data(), 1, gap, file) == gap);
+		isWritten = isWritten && std::fwrite(bucketTable.data(), sizeof(uint64_t), bucketTable.size(), file) == bucketTable.size();
+
+		gap = static_cast<size_t>(header.entryOffset - header.bucketTableOffset - bucketTable.size() * sizeof(uint64_t));
+		isWritten = isWritten && (gap == 0 || std::fwrite(buffer.data(), 1, gap, file) == gap);
+
+		for (size_t first = 0; isWritten && first < _elementCount; first += chunkEntries)
+		{
+			size_t count = (_elementCount - first < chunkEntries) ? _elementCount - first : chunkEntries;
+
+			std::memset(buffer.data(), 0, count * sizeof(Entry));
+
+			for (size_t i = 0; i < count; ++i)
+			{
+				char* entry = buffer.data() + i * sizeof(Entry);
+				std::memcpy(entry + offsetof(Entry, first), &order[first + i]->first, sizeof(KeyType));
+				std::memcpy(entry + offsetof(Entry, second), &order[first + i]->second, sizeof(ValueType));
+			}
+
+			isWritten = std::fwrite(buffer.data(), sizeof(Entry), count, file) == count;
+		}
+
+		isWritten = (std::fclose(file) == 0) && isWritten;
+
+		if (!isWritten)
+			std::remove(_path.c_str());
+
+		return isWritten;
+	}
+}
+
+#endif // !_HASH_SNAPSHOT_H_
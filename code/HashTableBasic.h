@@ -3,6 +3,23 @@
 
 #include <utility>
 #include <functional>
+#include <type_traits>
+#include <iterator>
+#include <vector>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <xmmintrin.h>
+#endif
+
+#ifdef BHT_ENABLE_STATS
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#endif
+
+#include "NodePool.h"
+#include "BucketIndex.h"
+#include "ParallelFor.h"
 
 namespace BHT_NAMESPACE
 {
@@ -22,7 +39,176 @@ namespace BHT_NAMESPACE
 		{
 			return 2.0f;
 		}
+
+		// 0 -     
+		static float defaultMinLoadFactor()
+		{
+			return 0.0f;
+		}
+
+		static size_t defaultRehashStep()
+		{
+			return 16;
+		}
+
+		static size_t defaultParallelRehashThreshold()
+		{
+			return 1 << 20;
+		}
+
+		// 0 -   
+		static size_t defaultRehashThreadCount()
+		{
+			return 0;
+		}
+
+		//  ,  findBatch/containsBatch   
+		static constexpr size_t findBatchWindow = 16;
+
+		//    ,   build  (      L2)
+		static constexpr size_t buildSectionBuckets = 8192;
+
+		// clear()   (minLoadFactor > 0)     ,   
+		//  sparseClearMinBuckets    sparseClearRatio   
+		static constexpr size_t sparseClearMinBuckets = 4096;
+		static constexpr size_t sparseClearRatio = 8;
+
+		//    ,     clear()
+		static constexpr size_t usedBlockBuckets = 64;
+	};
+
+
+	//    (build)
+	struct BuildOptions
+	{
+		//  ,      ,    
+		bool uniqueKeys = false;
+	};
+
+
+	//  ,   getMemoryUsage(). ,     
+	// (,   ),  
+	struct HashTableMemoryUsage
+	{
+		size_t bucketBytes = 0;   //  (ChainedStorage),  (SwissStorage), (OrderedStorage)
+		size_t nodeBytes = 0;     //            
+		size_t payloadBytes = 0;  //   nodeBytes: size() * sizeof()
+		size_t totalBytes = 0;    // bucketBytes + nodeBytes
+	};
+
+#ifdef BHT_ENABLE_STATS
+	//   ,   getStats(). ,     BHT_ENABLE_STATS,
+	//            
+	struct HashTableStats
+	{
+		size_t elementCount = 0;
+		size_t bucketCount = 0;          //         
+		size_t emptyBucketCount = 0;
+		size_t maxChainLength = 0;
+
+		// chainLengthHistogram[i] -      i ,  - maxChainLength + 1
+		std::vector<size_t> chainLengthHistogram;
+
+		//   -   ,  ( ,  )
+		uint64_t findHitCount = 0;
+		uint64_t findMissCount = 0;
+		uint64_t maxHitProbeLength = 0;
+		uint64_t maxMissProbeLength = 0;
+		double averageHitProbeLength = 0.0;
+		double averageMissProbeLength = 0.0;
+
+		//    (reCreate)    
+		uint64_t rehashCount = 0;
+		uint64_t rehashNanoseconds = 0;
+
+		//    (  )
+		size_t nodeMemoryBytes = 0;
+	};
+
+	//    .       ,  
+	// (relaxed).     
+	struct HashTableStatsCounters
+	{
+		std::atomic<uint64_t> findHitCount{ 0 };
+		std::atomic<uint64_t> findMissCount{ 0 };
+		std::atomic<uint64_t> hitProbeTotal{ 0 };
+		std::atomic<uint64_t> missProbeTotal{ 0 };
+		std::atomic<uint64_t> maxHitProbeLength{ 0 };
+		std::atomic<uint64_t> maxMissProbeLength{ 0 };
+		std::atomic<uint64_t> rehashCount{ 0 };
+		std::atomic<uint64_t> rehashNanoseconds{ 0 };
+
+		HashTableStatsCounters() = default;
+
+		HashTableStatsCounters(const HashTableStatsCounters&) noexcept {};
+
+		HashTableStatsCounters& operator=(const HashTableStatsCounters&) noexcept
+		{
+			return *this;
+		}
+
+		static void updateMax(std::atomic<uint64_t>& _max, uint64_t _value) noexcept
+		{
+			uint64_t current = _max.load(std::memory_order_relaxed);
+
+			while (current < _value && !_max.compare_exchange_weak(current, _value, std::memory_order_relaxed)) {}
+		}
+
+		void recordFind(bool _isHit, uint64_t _probeLength) noexcept
+		{
+			(_isHit ? findHitCount : findMissCount).fetch_add(1, std::memory_order_relaxed);
+			(_isHit ? hitProbeTotal : missProbeTotal).fetch_add(_probeLength, std::memory_order_relaxed);
+			updateMax(_isHit ? maxHitProbeLength : maxMissProbeLength, _probeLength);
+		}
+
+		void recordRehash(std::chrono::steady_clock::time_point _start) noexcept
+		{
+			uint64_t duration = static_cast<uint64_t>(
+				std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - _start).count());
+
+			rehashCount.fetch_add(1, std::memory_order_relaxed);
+			rehashNanoseconds.fetch_add(duration, std::memory_order_relaxed);
+		}
+
+		void fill(HashTableStats& _stats) const noexcept
+		{
+			_stats.findHitCount = findHitCount.load(std::memory_order_relaxed);
+			_stats.findMissCount = findMissCount.load(std::memory_order_relaxed);
+			_stats.maxHitProbeLength = maxHitProbeLength.load(std::memory_order_relaxed);
+			_stats.maxMissProbeLength = maxMissProbeLength.load(std::memory_order_relaxed);
+			_stats.rehashCount = rehashCount.load(std::memory_order_relaxed);
+			_stats.rehashNanoseconds = rehashNanoseconds.load(std::memory_order_relaxed);
+
+			if (_stats.findHitCount != 0)
+				_stats.averageHitProbeLength = static_cast<double>(hitProbeTotal.load(std::memory_order_relaxed)) / _stats.findHitCount;
+
+			if (_stats.findMissCount != 0)
+				_stats.averageMissProbeLength = static_cast<double>(missProbeTotal.load(std::memory_order_relaxed)) / _stats.findMissCount;
+		}
+
+		void reset() noexcept
+		{
+			for (std::atomic<uint64_t>* counter : { &findHitCount, &findMissCount, &hitProbeTotal, &missProbeTotal,
+				&maxHitProbeLength, &maxMissProbeLength, &rehashCount, &rehashNanoseconds })
+			{
+				counter->store(0, std::memory_order_relaxed);
+			}
+		}
 	};
+#endif
+
+
+	// Hasher  EqualComp  is_transparent:     ,      
+	template<typename Hasher, typename EqualComp, typename = void>
+	struct IsTransparentLookup : std::false_type {};
+
+	template<typename Hasher, typename EqualComp>
+	struct IsTransparentLookup<Hasher, EqualComp, std::void_t<typename Hasher::is_transparent, typename EqualComp::is_transparent>> :
+		std::true_type {};
+
+	//       K,    
+	template<typename Hasher, typename EqualComp, typename K>
+	using EnableTransparentLookup = typename std::enable_if<IsTransparentLookup<Hasher, EqualComp>::value, K>::type;
 
 
 	template<typename KeyType, typename Hasher>
@@ -34,14 +220,173 @@ namespace BHT_NAMESPACE
 		noexcept (static_cast<bool>(std::declval<const Comparator&>()(std::declval<const KeyType&>(), std::declval<const KeyType&>())));
 
 
-	template<bool Multi, typename NodeType, typename Hasher, typename EqualComp>
+	// minLoadFactor(0 -  )      loadFactor,    
+	// (maxLoadFactor / gainFactor).   loadFactor   ,   
+	//          ,     gainFactor 
+	// ,       
+	inline bool isValidMinLoadFactor(float _minLoadFactor, float _maxLoadFactor, float _gainFactor) noexcept
+	{
+		return _minLoadFactor == 0.0f || (_minLoadFactor > 0.0f && _minLoadFactor * 2.0f * _gainFactor <= _maxLoadFactor);
+	}
+
+
+	//    -  _address ,    
+	inline void prefetchRead(const void* _address) noexcept
+	{
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+		_mm_prefetch(static_cast<const char*>(_address), _MM_HINT_T0);
+#elif defined(__GNUC__) || defined(__clang__)
+		__builtin_prefetch(_address, 0, 3);
+#else
+		(void)_address;
+#endif
+	}
+
+
+	//       ,     .  :
+	//  -     
+	//  - matchHash(hash)  false,      hash     ,
+	//          matchHash
+	//  - isFullHash == true,     ( hash),       
+
+	//  :      ,      .
+	//        ()
+	struct FullNodeHash
+	{
+		static constexpr bool isFullHash = true;
+
+		const size_t hash;
+
+		explicit FullNodeHash(size_t _hash) noexcept : hash(_hash) {};
+
+		bool matchHash(size_t _hash) const noexcept { return hash == _hash; }
+	};
+
+	// 32-  :        ,    4 .
+	//        
+	struct TagNodeHash
+	{
+		static constexpr bool isFullHash = false;
+
+		const uint32_t hashTag;
+
+		explicit TagNodeHash(size_t _hash) noexcept : hashTag(foldHash32(_hash)) {};
+
+		bool matchHash(size_t _hash) const noexcept { return hashTag == foldHash32(_hash); }
+	};
+
+	//   :   ,      ,  
+	//      .      ( )
+	struct NoNodeHash
+	{
+		static constexpr bool isFullHash = false;
+
+		explicit NoNodeHash(size_t) noexcept {};
+
+		bool matchHash(size_t) const noexcept { return true; }
+	};
+
+
+	//    ,    ChainLinks::Links<NodeType>
+
+	//  :         O(1)
+	struct DoublyLinkedChain
+	{
+		template<typename NodeType>
+		struct Links
+		{
+			static constexpr bool isSinglyLinked = false;
+
+			NodeType* prev = nullptr;
+			NodeType* next = nullptr;
+		};
+	};
+
+	//  :    .         ,
+	//   ,   multi  equal       
+	//   (O( ))
+	struct SinglyLinkedChain
+	{
+		template<typename NodeType>
+		struct Links
+		{
+			static constexpr bool isSinglyLinked = true;
+
+			NodeType* next = nullptr;
+		};
+	};
+
+
+	template<bool Multi, typename NodeType, typename Hasher, typename EqualComp, typename IndexPolicy,
+		typename Allocator = std::allocator<NodeType>>
 	class HashTable;
+
+	//    front-end':  ,      .
+	// IndexPolicy       (BucketIndex.h),
+	// NodeHash -     (FullNodeHash, TagNodeHash, NoNodeHash),
+	// ChainLinks -   (DoublyLinkedChain, SinglyLinkedChain).
+	// Table   front-end',   rebind'     
+	template<typename IndexPolicy = PowerOfTwoIndex, typename NodeHash = FullNodeHash, typename ChainLinks = DoublyLinkedChain>
+	struct BasicChainedStorage
+	{
+		static constexpr bool isFlat = false;
+
+		using NodeHashType = NodeHash;
+		using ChainLinksType = ChainLinks;
+
+		template<bool Multi, typename NodeType, typename Hasher, typename EqualComp, typename Allocator = std::allocator<NodeType>>
+		using Table = HashTable<Multi, NodeType, Hasher, EqualComp, IndexPolicy, Allocator>;
+	};
+
+	using ChainedStorage = BasicChainedStorage<>;
+	using TagHashChainedStorage = BasicChainedStorage<PowerOfTwoIndex, TagNodeHash>;
+	using NoHashChainedStorage = BasicChainedStorage<PowerOfTwoIndex, NoNodeHash>;
+	using SinglyLinkedChainedStorage = BasicChainedStorage<PowerOfTwoIndex, FullNodeHash, SinglyLinkedChain>;
+
+	// ,   beforeBegin  end.     ,    
+	//        ,        
+	template<typename NodeType>
+	struct SentinelNodes
+	{
+		alignas(NodeType) static inline unsigned char beforeBegin[sizeof(NodeType)];
+		alignas(NodeType) static inline unsigned char end[sizeof(NodeType)];
+	};
+
+	//    ,   Storage(FullNodeHash,   )
+	template<typename Storage, typename = void>
+	struct StorageNodeHash
+	{
+		using type = FullNodeHash;
+	};
+
+	template<typename Storage>
+	struct StorageNodeHash<Storage, std::void_t<typename Storage::NodeHashType>>
+	{
+		using type = typename Storage::NodeHashType;
+	};
+
+	//    ,   Storage(DoublyLinkedChain,   )
+	template<typename Storage, typename = void>
+	struct StorageChainLinks
+	{
+		using type = DoublyLinkedChain;
+	};
+
+	template<typename Storage>
+	struct StorageChainLinks<Storage, std::void_t<typename Storage::ChainLinksType>>
+	{
+		using type = typename Storage::ChainLinksType;
+	};
 }
 
 
-template<bool Multi, typename NodeType, typename Hasher, typename EqualComp>
+template<bool Multi, typename NodeType, typename Hasher, typename EqualComp, typename IndexPolicy, typename Allocator>
 class BHT_NAMESPACE::HashTable
 {
+public:
+
+	using AllocatorType = Allocator;
+
 protected:
 
 	using DefProps = HashTableDefaultProperties;
@@ -54,75 +399,115 @@ protected:
 		NodeType* head = nullptr;
 	};
 
+	using BucketAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Bucket>;
+	using BucketAllocatorTraits = std::allocator_traits<BucketAllocator>;
+
 //Properties(fields)----------------------------------------------------------------------------------------------------------------------------
 
 	static constexpr bool isMulti = Multi;
 
-	Bucket* bucketArray = nullptr;
+	//      ,   : bucketArray     
+	// (emptyBucketArray), bucketCount  0,  bucketIndex      0,  
+	//       .     
+	Bucket* bucketArray = emptyBucketArray();
 
-	size_t bucketCount = DefProps::deafaultBucketCount();
+	size_t bucketCount = 0;
 	size_t elementCount = 0;
 
+	IndexPolicy bucketIndex;
+
+	//  :  oldBucketArray  nullptr,     
+	// >= migratedBucketCount   ,         
+	Bucket* oldBucketArray = nullptr;
+	size_t oldBucketCount = 0;
+	size_t migratedBucketCount = 0;
+	IndexPolicy oldBucketIndex;
+	size_t rehashStep = DefProps::defaultRehashStep();
+	bool incrementalRehash = false;
+
+	//  : reCreate    ,
+	//      parallelRehashThreshold 
+	bool parallelRehash = false;
+	size_t parallelRehashThreshold = DefProps::defaultParallelRehashThreshold();
+	size_t rehashThreadCount = DefProps::defaultRehashThreadCount();
+
 	float loadFactor = 0.0f;
 	float maxLoadFactor = DefProps::defaultMaxLoadFactor();
 	float gainFactor = DefProps::defaultGainFactor();
+	float minLoadFactor = DefProps::defaultMinLoadFactor();
 
 	Hasher hasher;
 	EqualComp comp;
 
+	//   ,       rebind  Bucket
+	NodePool<NodeType, Allocator> nodePool;
+
+#ifdef BHT_ENABLE_STATS
+	mutable HashTableStatsCounters statsCounters;
+#endif
+
 	NodeType* beginPtr = nullptr;
 	NodeType* backPtr = nullptr;
-	NodeType* beforeBeginPtr;
-	NodeType* endPtr;
+	NodeType* beforeBeginPtr = reinterpret_cast<NodeType*>(SentinelNodes<NodeType>::beforeBegin);
+	NodeType* endPtr = reinterpret_cast<NodeType*>(SentinelNodes<NodeType>::end);
 
 //Protected Methods-----------------------------------------------------------------------------------------------------------------------------
 
 	//Constructors & Destructor-----------------------------------------------------------------------------------------------------------------
 
-	HashTable()
+	//   ,      
+	HashTable() : HashTable(Allocator()) {};
+
+	explicit HashTable(const Allocator& _allocator) : nodePool(_allocator)
 	{
 		if (isValidHasher<KeyType, Hasher> && isValidComparator<KeyType, EqualComp>) {};
-		
-		bucketArray = new Bucket[bucketCount];
-		beforeBeginPtr = reinterpret_cast<NodeType*>(new char[sizeof(NodeType)]);
-		endPtr = reinterpret_cast<NodeType*>(new char[sizeof(NodeType)]);
+
+		bucketIndex.setBucketCount(1);
 	}
 
-	HashTable(size_t _bucketCount) : bucketCount(_bucketCount), HashTable() {};
+	HashTable(size_t _bucketCount, const Allocator& _allocator = Allocator()) : HashTable(_allocator)
+	{
+		allocateBucketArray(_bucketCount);
+	}
 
 	~HashTable()
 	{
-		clear();
+		destroyAllNodes();
 
-		delete[] bucketArray;
-		delete[] reinterpret_cast<char*>(beforeBeginPtr);
-		delete[] reinterpret_cast<char*>(endPtr);
+		freeBucketArray(bucketArray, bucketCount);
+		freeBucketArray(oldBucketArray, oldBucketCount);
 	}
 
 	//Specific Methods--------------------------------------------------------------------------------------------------------------------------
 
-	void checkLoadFactor() noexcept
+	template<typename Func>
+	void forEachNode(Func _func) const
 	{
-		loadFactor = static_cast<float>(elementCount) / bucketCount;
-
-		if (loadFactor > maxLoadFactor)
-			reCreate(bucketCount * gainFactor);
-	}
+		NodeType* current = nullptr;
+		NodeType* prev = nullptr;
 
-	void reCreate(size_t _newBucketCount) noexcept
-	{
-		Bucket* oldBucketArray = bucketArray;
-		size_t oldBucketCount = bucketCount;
+		const unsigned char* blocks = usedBlocks();
 
-		bucketCount = _newBucketCount;
+		//     ,      
+		for (size_t i = 0; i < bucketCount; ++i)
+		{
+			if (i % DefProps::usedBlockBuckets == 0 && !blocks[i / DefProps::usedBlockBuckets])
+			{
+				i += DefProps::usedBlockBuckets - 1;
+				continue;
+			}
 
-		bucketArray = new Bucket[bucketCount];
+			current = bucketArray[i].head;
+			while (current)
+			{
+				prev = current;
+				current = current->next;
 
-		NodeType* current = nullptr;
-		NodeType* prev = nullptr;
+				_func(prev); // next  ,  _func     
+			}
+		}
 
-		//   
-		for (size_t i = 0; i < oldBucketCount; ++i)
+		for (size_t i = migratedBucketCount; i < oldBucketCount; ++i)
 		{
 			current = oldBucketArray[i].head;
 			while (current)
@@ -130,309 +515,1103 @@ protected:
 				prev = current;
 				current = current->next;
 
-				placeExistNode(prev);
+				_func(prev);
 			}
 		}
-
-		setBeginBack();
-
-		delete[] oldBucketArray;
 	}
 
-	void placeNewNode(NodeType* _newNode) noexcept
+	//    -   ,     
+	size_t visitUnitCount() const noexcept
 	{
-		size_t index = _newNode->hash % bucketCount;
+		return bucketCount + oldBucketCount - migratedBucketCount;
+	}
 
-		//      
-		if (bucketArray[index].head)
+	//  _func(NodeType*)      [_first, _last)   visitUnitCount
+	template<typename Func>
+	void forEachNodeInUnits(size_t _first, size_t _last, Func _func) const
+	{
+		for (size_t i = _first; i < _last; ++i)
 		{
-			bucketArray[index].head->prev = _newNode;
-			_newNode->next = bucketArray[index].head;
-		}
+			NodeType* current = (i < bucketCount) ? bucketArray[i].head : oldBucketArray[migratedBucketCount + i - bucketCount].head;
 
-		bucketArray[index].head = _newNode;
+			while (current)
+			{
+				_func(current);
+				current = current->next;
+			}
+		}
 	}
 
-	void placeNewNodeIfSameFound(NodeType* _foundNode, NodeType* _newNode) noexcept
+	//   ,      IndexPolicy
+	void allocateBucketArray(size_t _bucketCount)
 	{
-		//       equal 
-		if (_foundNode->prev)
-		{
-			_foundNode->prev->next = _newNode;
-			_newNode->prev = _foundNode->prev;
-		}
-		else
-		{
-			bucketArray[_newNode->hash % bucketCount].head = _newNode;
-		}
+		bucketCount = IndexPolicy::roundBucketCount(_bucketCount);
+		bucketIndex.setBucketCount(bucketCount);
 
-		_foundNode->prev = _newNode;
-		_newNode->next = _foundNode;
+		BucketAllocator allocator(nodePool.getAllocator());
+		bucketArray = BucketAllocatorTraits::allocate(allocator, bucketAllocationSize(bucketCount));
+		std::uninitialized_fill_n(bucketArray, bucketCount, Bucket());
+		std::uninitialized_fill_n(usedBlocks(), usedBlockCount(bucketCount), static_cast<unsigned char>(0));
 	}
 
-	void placeExistNode(NodeType* _node) noexcept
+	static size_t usedBlockCount(size_t _bucketCount) noexcept
 	{
-		_node->prev = _node->next = nullptr; //    
+		return (_bucketCount + DefProps::usedBlockBuckets - 1) / DefProps::usedBlockBuckets;
+	}
 
-		placeNewNode(_node);
+	//        (usedBlocks),     
+	static size_t bucketAllocationSize(size_t _bucketCount) noexcept
+	{
+		return _bucketCount + (usedBlockCount(_bucketCount) + sizeof(Bucket) - 1) / sizeof(Bucket);
 	}
 
-	void updateBeginBack(NodeType* _node) noexcept
+	//    usedBlockBuckets            
+	//  clearUsedBuckets,        
+	unsigned char* usedBlocks() const noexcept
 	{
-		if (beginPtr)
-		{
-			if ((_node->hash % bucketCount) <= (beginPtr->hash % bucketCount))
-			{
-				beginPtr = _node; //    , .     ,    begin
-				return;
-			}
+		return reinterpret_cast<unsigned char*>(bucketArray + bucketCount);
+	}
 
-			if ((_node->hash % bucketCount) > (backPtr->hash % bucketCount))
-			{
-				backPtr = _node; //    , .     ,      back
-			}
-		}
-		else
-		{
-			beginPtr = backPtr = _node;
-		}
+	void markUsedBucket(size_t _index) noexcept
+	{
+		usedBlocks()[_index / DefProps::usedBlockBuckets] = 1;
 	}
 
-	void setBeginBack() noexcept
+	//     :       ,    
+	void clearUsedBuckets() noexcept
 	{
-		//  beginPtr
-		for (size_t i = 0; i < bucketCount; ++i)
-		{
-			if (bucketArray[i].head)
-			{
-				beginPtr = bucketArray[i].head;
-				break;
-			}
-		}
+		unsigned char* blocks = usedBlocks();
+		size_t blockCount = usedBlockCount(bucketCount);
 
-		//  backPtr
-		for (size_t i = bucketCount - 1; i > 0; --i) //    
+		for (size_t b = 0; b < blockCount; ++b)
 		{
-			if (bucketArray[i].head)
-			{
-				backPtr = bucketArray[i].head;
+			if (!blocks[b])
+				continue;
 
-				while (backPtr->next)
-					backPtr = backPtr->next;
+			size_t first = b * DefProps::usedBlockBuckets;
+			size_t last = (first + DefProps::usedBlockBuckets < bucketCount) ? first + DefProps::usedBlockBuckets : bucketCount;
 
-				return;
-			}
+			for (size_t i = first; i < last; ++i)
+				bucketArray[i].head = nullptr;
+
+			blocks[b] = 0;
 		}
+	}
 
-		//   0 , .     
-		if (bucketArray[0].head)
-		{
-			backPtr = bucketArray[0].head;
+	//       ,        .
+	//     
+	static Bucket* emptyBucketArray() noexcept
+	{
+		static Bucket emptyBucket;
+		return &emptyBucket;
+	}
 
-			while (backPtr->next)
-				backPtr = backPtr->next;
+	// _bucketCount - ,    . Bucket  ,    
+	void freeBucketArray(Bucket* _bucketArray, size_t _bucketCount) noexcept
+	{
+		if (_bucketArray && _bucketArray != emptyBucketArray())
+		{
+			BucketAllocator allocator(nodePool.getAllocator());
+			BucketAllocatorTraits::deallocate(allocator, _bucketArray, bucketAllocationSize(_bucketCount));
 		}
 	}
 
-	//Construction------------------------------------------------------------------------------------------------------------------------------
+	//       ,    
+	void setEmptyBucketArray() noexcept
+	{
+		bucketArray = emptyBucketArray();
+		bucketCount = 0;
+		bucketIndex.setBucketCount(1);
+	}
 
-	void copyConstruct(const HashTable& _other)
+	//     ,    .    
+	void ensureBucketArray()
 	{
-		//   _other 
-		bucketCount = _other.bucketCount;
-		elementCount = _other.elementCount;
-		loadFactor = _other.loadFactor;
-		maxLoadFactor = _other.maxLoadFactor;
-		gainFactor = _other.gainFactor;
+		if (bucketCount == 0)
+			allocateBucketArray(DefProps::deafaultBucketCount());
+	}
 
-		delete[] bucketArray;
-		bucketArray = new Bucket[bucketCount];
+	float currentLoadFactor() const noexcept
+	{
+		return (bucketCount != 0) ? static_cast<float>(elementCount) / bucketCount : 0.0f;
+	}
 
-		NodeType* current = nullptr;
-		NodeType* newNode = nullptr;
+	void destroyAllNodes() noexcept
+	{
+		//       ,   
+		if (!std::is_trivially_destructible<NodeType>::value)
+			forEachNode([](NodeType* _node) { _node->~NodeType(); });
 
-		//    _other
-		for (size_t i = 0; i < bucketCount; ++i)
-		{
-			current = _other.bucketArray[i].head;
-			while (current)
-			{
-				newNode = new NodeType(current);
-				placeNewNode(newNode);
-				updateBeginBack(newNode);
+		nodePool.release();
+	}
 
-				current = current->next;
-			}
+	void checkLoadFactor() noexcept
+	{
+		loadFactor = currentLoadFactor();
+
+		if (loadFactor > maxLoadFactor)
+		{
+			if (incrementalRehash)
+				startRehash(bucketCount * gainFactor);
+			else
+				reCreate(bucketCount * gainFactor);
 		}
 	}
 
-	void moveConstruct(HashTable& _other) noexcept
+	//    (  eraseSingleNode:      
+	//     ).    loadFactor,   
+	void checkShrink() noexcept
 	{
-		//   _other 
-		bucketCount = _other.bucketCount;
-		elementCount = _other.elementCount;
-		loadFactor = _other.loadFactor;
-		maxLoadFactor = _other.maxLoadFactor;
-		gainFactor = _other.gainFactor;
+		if (minLoadFactor == 0.0f || currentLoadFactor() >= minLoadFactor)
+			return;
 
-		delete[] bucketArray;
-		bucketArray = _other.bucketArray;
+		size_t newBucketCount = static_cast<size_t>(elementCount * gainFactor / maxLoadFactor) + 1;
 
-		//  _other  default 
-		_other.bucketCount = DefProps::deafaultBucketCount();
+		if (newBucketCount < DefProps::deafaultBucketCount())
+			newBucketCount = DefProps::deafaultBucketCount();
+
+		if (IndexPolicy::roundBucketCount(newBucketCount) < bucketCount)
+		{
+			reCreate(newBucketCount);
+			loadFactor = currentLoadFactor();
+		}
+	}
+
+	void reCreate(size_t _newBucketCount) noexcept
+	{
+#ifdef BHT_ENABLE_STATS
+		std::chrono::steady_clock::time_point rehashStart = std::chrono::steady_clock::now();
+#endif
+
+		if (oldBucketArray)
+			finishRehash();
+
+		Bucket* prevBucketArray = bucketArray;
+		size_t prevBucketCount = bucketCount;
+
+		allocateBucketArray(_newBucketCount);
+
+		size_t threadCount = rehashThreads(prevBucketCount);
+
+		if (threadCount > 1)
+		{
+			parallelRedistribute(prevBucketArray, prevBucketCount, threadCount);
+		}
+		else
+		{
+			NodeType* current = nullptr;
+			NodeType* prev = nullptr;
+
+			//   
+			for (size_t i = 0; i < prevBucketCount; ++i)
+			{
+				current = prevBucketArray[i].head;
+				while (current)
+				{
+					prev = current;
+					current = current->next;
+
+					placeExistNode(prev);
+				}
+			}
+
+			setBeginBack();
+		}
+
+		freeBucketArray(prevBucketArray, prevBucketCount);
+
+#ifdef BHT_ENABLE_STATS
+		statsCounters.recordRehash(rehashStart);
+#endif
+	}
+
+	//Parallel Rehash---------------------------------------------------------------------------------------------------------------------------
+
+	//     _prevBucketCount , 1 -  
+	size_t rehashThreads(size_t _prevBucketCount) const noexcept
+	{
+		if (!parallelRehash || elementCount < parallelRehashThreshold)
+			return 1;
+
+		size_t threadCount = (rehashThreadCount != 0) ? rehashThreadCount : defaultThreadCount();
+
+		//            
+		if (threadCount > _prevBucketCount)
+			threadCount = _prevBucketCount;
+
+		if (threadCount > bucketCount)
+			threadCount = bucketCount;
+
+		return (threadCount == 0) ? 1 : threadCount;
+	}
+
+	//      ( )  _threadCount    .
+	// 1:  w           routes[w][d]( next),
+	//     d -   ,    
+	// 2:  d     routes[*][d]     ,  
+	//           .         
+	//         ,   equal  multi  
+	void parallelRedistribute(Bucket* _prevBucketArray, size_t _prevBucketCount, size_t _threadCount) noexcept
+	{
+		size_t oldPartSize = (_prevBucketCount + _threadCount - 1) / _threadCount;
+		size_t newPartSize = (bucketCount + _threadCount - 1) / _threadCount;
+
+		//        usedBlocks,       
+		newPartSize = (newPartSize + DefProps::usedBlockBuckets - 1) / DefProps::usedBlockBuckets * DefProps::usedBlockBuckets;
+
+		std::vector<NodeType*> routes(_threadCount * _threadCount, nullptr);
+		std::vector<NodeType*> partBegin(_threadCount, nullptr);
+		std::vector<NodeType*> partBack(_threadCount, nullptr);
+
+		parallelFor(_threadCount, [&](size_t _part)
+			{
+				NodeType** partRoutes = routes.data() + _part * _threadCount;
+				size_t first = _part * oldPartSize;
+				size_t last = (first + oldPartSize < _prevBucketCount) ? first + oldPartSize : _prevBucketCount;
+
+				for (size_t i = first; i < last; ++i)
+				{
+					NodeType* current = _prevBucketArray[i].head;
+
+					while (current)
+					{
+						NodeType* node = current;
+						current = current->next;
+
+						NodeType*& route = partRoutes[bucketIndex.index(nodeHash(node)) / newPartSize];
+						node->next = route;
+						route = node;
+					}
+				}
+			});
+
+		parallelFor(_threadCount, [&](size_t _part)
+			{
+				for (size_t w = 0; w < _threadCount; ++w)
+				{
+					NodeType* current = routes[w * _threadCount + _part];
+
+					while (current)
+					{
+						NodeType* node = current;
+						current = current->next;
+
+						placeExistNode(node);
+					}
+				}
+
+				size_t first = _part * newPartSize;
+				size_t last = (first + newPartSize < bucketCount) ? first + newPartSize : bucketCount;
+
+				for (size_t i = first; i < last && !partBegin[_part]; ++i)
+					partBegin[_part] = bucketArray[i].head;
+
+				for (size_t i = last; i > first && !partBack[_part]; --i)
+					partBack[_part] = bucketArray[i - 1].head;
+
+				if (partBack[_part])
+				{
+					while (partBack[_part]->next)
+						partBack[_part] = partBack[_part]->next;
+				}
+			});
+
+		beginPtr = backPtr = nullptr;
+
+		for (size_t i = 0; i < _threadCount && !beginPtr; ++i)
+			beginPtr = partBegin[i];
+
+		for (size_t i = _threadCount; i > 0 && !backPtr; --i)
+			backPtr = partBack[i - 1];
+	}
+
+	//Incremental Rehash------------------------------------------------------------------------------------------------------------------------
+
+	void startRehash(size_t _newBucketCount) noexcept
+	{
+#ifdef BHT_ENABLE_STATS
+		std::chrono::steady_clock::time_point rehashStart = std::chrono::steady_clock::now();
+#endif
+
+		if (oldBucketArray)
+			finishRehash();
+
+		//    ,      rehashStep   .
+		//   , .     ,   
+		oldBucketArray = bucketArray;
+		oldBucketCount = bucketCount;
+		oldBucketIndex = bucketIndex;
+		migratedBucketCount = 0;
+
+		allocateBucketArray(_newBucketCount);
+
+		loadFactor = currentLoadFactor();
+
+#ifdef BHT_ENABLE_STATS
+		statsCounters.recordRehash(rehashStart); //   ,     
+#endif
+	}
+
+	void migrateBuckets(size_t _count) noexcept
+	{
+		bool beginBackMoved = false;
+
+		while (oldBucketArray && _count > 0)
+		{
+			NodeType* current = oldBucketArray[migratedBucketCount].head;
+			NodeType* prev = nullptr;
+
+			// begin  back     :        
+			//   back( begin)  updateBeginBack,    back  
+			for (NodeType* node = current; node && !beginBackMoved; node = node->next)
+			{
+				if (node == beginPtr || node == backPtr)
+					beginBackMoved = true;
+			}
+
+			//    ,  locateBucket     
+			oldBucketArray[migratedBucketCount].head = nullptr;
+			++migratedBucketCount;
+			--_count;
+
+			while (current)
+			{
+				prev = current;
+				current = current->next;
+
+				placeExistNode(prev);
+
+				if (!beginBackMoved)
+					updateBeginBack(prev);
+			}
+
+			if (migratedBucketCount == oldBucketCount)
+			{
+				freeBucketArray(oldBucketArray, oldBucketCount);
+				oldBucketArray = nullptr;
+				oldBucketCount = migratedBucketCount = 0;
+			}
+		}
+
+		if (beginBackMoved)
+			setBeginBack();
+	}
+
+	void migrateBuckets() noexcept
+	{
+		if (oldBucketArray)
+			migrateBuckets(rehashStep);
+	}
+
+	// ,   (  )    _hash
+	Bucket& locateBucket(size_t _hash) const noexcept
+	{
+		if (oldBucketArray)
+		{
+			size_t oldIndex = oldBucketIndex.index(_hash);
+
+			if (oldIndex >= migratedBucketCount)
+				return oldBucketArray[oldIndex];
+		}
+
+		return bucketArray[bucketIndex.index(_hash)];
+	}
+
+	//       _hash,  locateBucket.      usedBlocks
+	Bucket& placementBucket(size_t _hash) noexcept
+	{
+		if (oldBucketArray)
+		{
+			size_t oldIndex = oldBucketIndex.index(_hash);
+
+			if (oldIndex >= migratedBucketCount)
+				return oldBucketArray[oldIndex];
+		}
+
+		size_t index = bucketIndex.index(_hash);
+		markUsedBucket(index);
+
+		return bucketArray[index];
+	}
+
+	//     :   ,     
+	size_t iterationIndex(size_t _hash) const noexcept
+	{
+		if (oldBucketArray)
+		{
+			size_t oldIndex = oldBucketIndex.index(_hash);
+
+			if (oldIndex >= migratedBucketCount)
+				return bucketCount + oldIndex;
+		}
+
+		return bucketIndex.index(_hash);
+	}
+
+	//   :   (FullNodeHash)    
+	size_t nodeHash(const NodeType* _node) const noexcept
+	{
+		return nodeHash(_node, std::integral_constant<bool, NodeType::isFullHash>());
+	}
+
+	size_t nodeHash(const NodeType* _node, std::true_type) const noexcept
+	{
+		return _node->hash;
+	}
+
+	size_t nodeHash(const NodeType* _node, std::false_type) const noexcept
+	{
+		return hasher(_node->getKey());
+	}
+
+	//     nullptr,  _node   . _hash -   _node.
+	//       , ,    ,  nullptr
+	NodeType* chainPrev(const NodeType* _node, size_t _hash) const noexcept
+	{
+		return chainPrev(_node, _hash, std::integral_constant<bool, NodeType::isSinglyLinked>());
+	}
+
+	NodeType* chainPrev(const NodeType* _node, size_t, std::false_type) const noexcept
+	{
+		return _node->prev;
+	}
+
+	NodeType* chainPrev(const NodeType* _node, size_t _hash, std::true_type) const noexcept
+	{
+		NodeType* current = locateBucket(_hash).head;
+
+		if (current == _node)
+			return nullptr;
+
+		while (current && current->next != _node)
+			current = current->next;
+
+		return current;
+	}
+
+	//    (     )
+	void setChainPrev(NodeType* _node, NodeType* _prev) const noexcept
+	{
+		setChainPrev(_node, _prev, std::integral_constant<bool, NodeType::isSinglyLinked>());
+	}
+
+	void setChainPrev(NodeType* _node, NodeType* _prev, std::false_type) const noexcept
+	{
+		_node->prev = _prev;
+	}
+
+	void setChainPrev(NodeType*, NodeType*, std::true_type) const noexcept {}
+
+	//        >= _index,  nullptr
+	NodeType* firstNodeFrom(size_t _index) const noexcept
+	{
+		for (; _index < bucketCount; ++_index)
+		{
+			if (bucketArray[_index].head)
+				return bucketArray[_index].head;
+		}
+
+		if (!oldBucketArray)
+			return nullptr;
+
+		size_t oldIndex = _index - bucketCount;
+		if (oldIndex < migratedBucketCount)
+			oldIndex = migratedBucketCount;
+
+		for (; oldIndex < oldBucketCount; ++oldIndex)
+		{
+			if (oldBucketArray[oldIndex].head)
+				return oldBucketArray[oldIndex].head;
+		}
+
+		return nullptr;
+	}
+
+	//        < _index,  nullptr
+	NodeType* lastNodeBefore(size_t _index) const noexcept
+	{
+		NodeType* current = nullptr;
+
+		if (oldBucketArray && _index > bucketCount)
+		{
+			size_t oldIndex = _index - bucketCount;
+
+			while (!current && oldIndex > migratedBucketCount)
+				current = oldBucketArray[--oldIndex].head;
+		}
+
+		if (_index > bucketCount)
+			_index = bucketCount;
+
+		while (!current && _index > 0)
+			current = bucketArray[--_index].head;
+
+		if (current)
+		{
+			while (current->next)
+				current = current->next;
+		}
+
+		return current;
+	}
+
+	//Placing-----------------------------------------------------------------------------------------------------------------------------------
+
+	void placeNewNode(NodeType* _newNode, size_t _hash) noexcept
+	{
+		Bucket& bucket = placementBucket(_hash);
+
+		//      
+		if (bucket.head)
+		{
+			setChainPrev(bucket.head, _newNode);
+			_newNode->next = bucket.head;
+		}
+
+		bucket.head = _newNode;
+	}
+
+	void placeNewNodeIfSameFound(NodeType* _foundNode, NodeType* _newNode, size_t _hash) noexcept
+	{
+		NodeType* foundPrev = chainPrev(_foundNode, _hash);
+
+		//       equal 
+		if (foundPrev)
+		{
+			foundPrev->next = _newNode;
+			setChainPrev(_newNode, foundPrev);
+		}
+		else
+		{
+			locateBucket(_hash).head = _newNode;
+		}
+
+		setChainPrev(_foundNode, _newNode);
+		_newNode->next = _foundNode;
+	}
+
+	void placeExistNode(NodeType* _node) noexcept
+	{
+		//    
+		setChainPrev(_node, nullptr);
+		_node->next = nullptr;
+
+		placeNewNode(_node, nodeHash(_node));
+	}
+
+	void updateBeginBack(NodeType* _node) noexcept
+	{
+		if (beginPtr)
+		{
+			size_t hash = nodeHash(_node);
+			size_t index = iterationIndex(hash);
+
+			size_t beginIndex = iterationIndex(nodeHash(beginPtr));
+
+			//    ,    begin,      
+			// ( multi      ,   equal )
+			if (index < beginIndex || (index == beginIndex && locateBucket(hash).head == _node))
+			{
+				beginPtr = _node;
+				return;
+			}
+
+			if (index > iterationIndex(nodeHash(backPtr)))
+			{
+				backPtr = _node; //    , .     ,      back
+			}
+		}
+		else
+		{
+			beginPtr = backPtr = _node;
+		}
+	}
+
+	void setBeginBack() noexcept
+	{
+		beginPtr = firstNodeFrom(0);
+		backPtr = lastNodeBefore(bucketCount + oldBucketCount); //     
+	}
+
+	//Construction------------------------------------------------------------------------------------------------------------------------------
+
+	void copyConstruct(const HashTable& _other)
+	{
+		//   _other 
+		elementCount = _other.elementCount;
+		loadFactor = _other.loadFactor;
+		maxLoadFactor = _other.maxLoadFactor;
+		gainFactor = _other.gainFactor;
+		minLoadFactor = _other.minLoadFactor;
+		rehashStep = _other.rehashStep;
+		incrementalRehash = _other.incrementalRehash;
+		parallelRehash = _other.parallelRehash;
+		parallelRehashThreshold = _other.parallelRehashThreshold;
+		rehashThreadCount = _other.rehashThreadCount;
+
+		freeBucketArray(bucketArray, bucketCount);
+		setEmptyBucketArray();
+
+		//  _other        
+		if (_other.bucketCount != 0)
+			allocateBucketArray(_other.bucketCount);
+
+		nodePool.reserve(elementCount);
+
+		//  _other   ,      
+		_other.forEachNode([this](NodeType* _node)
+			{
+				NodeType* newNode = nodePool.create(_node);
+				placeNewNode(newNode, nodeHash(newNode));
+				updateBeginBack(newNode);
+			});
+	}
+
+	//        _other:    _other   
+	void moveConstruct(HashTable& _other) noexcept
+	{
+		freeBucketArray(bucketArray, bucketCount);
+
+		//   _other 
+		bucketCount = _other.bucketCount;
+		elementCount = _other.elementCount;
+		loadFactor = _other.loadFactor;
+		maxLoadFactor = _other.maxLoadFactor;
+		gainFactor = _other.gainFactor;
+		minLoadFactor = _other.minLoadFactor;
+
+		rehashStep = _other.rehashStep;
+		incrementalRehash = _other.incrementalRehash;
+		parallelRehash = _other.parallelRehash;
+		parallelRehashThreshold = _other.parallelRehashThreshold;
+		rehashThreadCount = _other.rehashThreadCount;
+
+		bucketArray = _other.bucketArray;
+		bucketIndex = _other.bucketIndex;
+		oldBucketArray = _other.oldBucketArray;
+		oldBucketCount = _other.oldBucketCount;
+		oldBucketIndex = _other.oldBucketIndex;
+		migratedBucketCount = _other.migratedBucketCount;
+		beginPtr = _other.beginPtr;
+		backPtr = _other.backPtr;
+		nodePool.swap(_other.nodePool);
+
+		//  _other  default 
 		_other.maxLoadFactor = DefProps::defaultMaxLoadFactor();
 		_other.gainFactor = DefProps::defaultGainFactor();
+		_other.minLoadFactor = DefProps::defaultMinLoadFactor();
 		_other.elementCount = 0;
 		_other.loadFactor = 0.0;
+		_other.beginPtr = _other.backPtr = nullptr;
+		_other.oldBucketArray = nullptr;
+		_other.oldBucketCount = _other.migratedBucketCount = 0;
 
-		_other.bucketArray = new Bucket[_other.bucketCount];
+		//      , _other   ,     
+		_other.setEmptyBucketArray();
 	}
 
 	//Search------------------------------------------------------------------------------------------------------------------------------------
 
+	//  ,   ,   ,   _hash
+	template<typename K>
+	NodeType* findInChain(NodeType* _current, const K& _key, size_t _hash) const noexcept
+	{
+#ifdef BHT_ENABLE_STATS
+		uint64_t probeLength = 0;
+
+		for (; _current; _current = _current->next)
+		{
+			++probeLength;
+
+			if (_current->matchHash(_hash) && comp(_key, _current->getKey()))
+			{
+				statsCounters.recordFind(true, probeLength);
+				return _current;
+			}
+		}
+
+		statsCounters.recordFind(false, probeLength);
+		return endPtr;
+#else
+		while (_current)
+		{
+			if (_current->matchHash(_hash) && comp(_key, _current->getKey()))
+				return _current;
+
+			_current = _current->next;
+		}
+
+		return endPtr;
+#endif
+	}
+
 	NodeType* innerFind(const KeyType& _key, size_t _hash) const noexcept
 	{
-		NodeType* current = bucketArray[_hash % bucketCount].head;
+		return findInChain(locateBucket(_hash).head, _key, _hash);
+	}
+
+	//  :        KeyType
+	template<typename K, typename = EnableTransparentLookup<Hasher, EqualComp, K>>
+	NodeType* innerFind(const K& _key, size_t _hash) const noexcept
+	{
+		return findInChain(locateBucket(_hash).head, _key, _hash);
+	}
+
+	//    findBatchWindow :         ,
+	//          ,    .
+	//       _output(NodeType*),    endPtr
+	template<typename Output>
+	void innerFindBatch(const KeyType* _keys, size_t _count, Output _output) const
+	{
+		const size_t window = DefProps::findBatchWindow;
+		const Bucket* buckets[window];
+		size_t hashes[window];
+
+		for (size_t base = 0; base < _count; base += window)
+		{
+			size_t windowSize = (_count - base < window) ? _count - base : window;
+
+			for (size_t i = 0; i < windowSize; ++i)
+			{
+				hashes[i] = hasher(_keys[base + i]);
+				buckets[i] = &locateBucket(hashes[i]);
+				prefetchRead(buckets[i]);
+			}
+
+			for (size_t i = 0; i < windowSize; ++i)
+			{
+				if (buckets[i]->head)
+					prefetchRead(buckets[i]->head);
+			}
+
+			for (size_t i = 0; i < windowSize; ++i)
+				_output(findInChain(buckets[i]->head, _keys[base + i], hashes[i]));
+		}
+	}
+
+	template<typename K>
+	void markEqualRange(const K& _key, NodeType*& _first, NodeType*& _last) const noexcept
+	{
+		size_t hash = hasher(_key);
+		_first = _last = innerFind(_key, hash);
+
+		if (_first == endPtr)
+			return;
+
+		while (_last->next && _last->next->matchHash(hash) && (comp(_last->next->getKey(), _key)))
+			_last = _last->next;
+	}
+
+	template<typename K>
+	size_t innerCountByKey(const K& _key) const noexcept
+	{
+		size_t hash = hasher(_key);
+		NodeType* current = innerFind(_key, hash);
+		size_t count = 0;
+
+		if (current == endPtr)
+			return 0;
+
 		while (current)
 		{
-			if (comp(_key, current->getKey()))
-				return current;
+			if (current->matchHash(hash) && comp(current->getKey(), _key))
+			{
+				++count;
+				current = current->next;
+			}
+			else break;
+		}
 
-			current = current->next;
+		return count;
+	}
+
+	//Insertion---------------------------------------------------------------------------------------------------------------------------------
+
+	//     _key ,   (  multi),    (hash, _args...).
+	//       ,  ,     .
+	//       true,   
+	template<typename K, typename... Args>
+	std::pair<NodeType*, bool> innerEmplace(const K& _key, Args&&... _args)
+	{
+		size_t hash = hasher(_key);
+		NodeType* res = innerFind(_key, hash);
+
+		if (!isMulti && res != endPtr)
+			return { res, false };
+
+		ensureBucketArray();
+
+		NodeType* newNode = nodePool.create(hash, std::forward<Args>(_args)...);
+
+		//  multi        equal 
+		if (res != endPtr)
+			placeNewNodeIfSameFound(res, newNode, hash);
+		else
+			placeNewNode(newNode, hash);
+
+		++elementCount;
+		updateBeginBack(newNode);
+		migrateBuckets();
+		checkLoadFactor();
+
+		return { newNode, true };
+	}
+
+	template<typename KT>
+	NodeType* innerSetInsert(KT&& _key)
+	{
+		std::pair<NodeType*, bool> res = innerEmplace(_key, std::forward<KT>(_key));
+
+		//         endPtr
+		return res.second ? res.first : endPtr;
+	}
+
+	template<typename KT, typename VT>
+	NodeType* innerMapInsert(KT&& _key, VT&& _value)
+	{
+		std::pair<NodeType*, bool> res = innerEmplace(_key, std::forward<KT>(_key), std::forward<VT>(_value));
+
+		//         endPtr
+		return res.second ? res.first : endPtr;
+	}
+
+	template<typename Pair>
+	NodeType* innerMapPairInsert(Pair&& _pair)
+	{
+		std::pair<NodeType*, bool> res = innerEmplace(_pair.first, std::forward<Pair>(_pair));
+
+		//         endPtr
+		return res.second ? res.first : endPtr;
+	}
+
+	//Bulk Build--------------------------------------------------------------------------------------------------------------------------------
+
+	//       ,   
+	void resetForBuild() noexcept
+	{
+		destroyAllNodes();
+
+		freeBucketArray(oldBucketArray, oldBucketCount);
+		oldBucketArray = nullptr;
+		oldBucketCount = migratedBucketCount = 0;
+
+		elementCount = 0;
+		beginPtr = backPtr = nullptr;
+	}
+
+	//     [_first, _last), _getKey(*_first)   
+	template<typename InputIterator, typename GetKey>
+	void innerBuild(InputIterator _first, InputIterator _last, const BuildOptions& _options, GetKey _getKey)
+	{
+		innerBuild(_first, _last, _options, _getKey, typename std::iterator_traits<InputIterator>::iterator_category());
+	}
+
+	//  :   ,    ,    begin/back
+	template<typename InputIterator, typename GetKey>
+	void innerBuild(InputIterator _first, InputIterator _last, const BuildOptions& _options, GetKey _getKey, std::input_iterator_tag)
+	{
+		clear();
+
+		if (_first != _last)
+			ensureBucketArray();
+
+		try
+		{
+			for (; _first != _last; ++_first)
+			{
+				const KeyType& key = _getKey(*_first);
+				size_t hash = hasher(key);
+				NodeType* res = (_options.uniqueKeys) ? endPtr : innerFind(key, hash);
+
+				if (!isMulti && res != endPtr)
+					continue;
+
+				NodeType* newNode = nodePool.create(hash, *_first);
+
+				if (res != endPtr)
+					placeNewNodeIfSameFound(res, newNode, hash);
+				else
+					placeNewNode(newNode, hash);
+
+				++elementCount;
+				loadFactor = static_cast<float>(elementCount) / bucketCount;
+
+				if (loadFactor > maxLoadFactor)
+					reCreate(bucketCount * gainFactor);
+			}
+		}
+		catch (...)
+		{
+			//      , begin/back   
+			setBeginBack();
+			throw;
 		}
 
-		return endPtr;
+		setBeginBack();
 	}
 
-	void markEqualRange(const KeyType& _key, NodeType*& _first, NodeType*& _last) const noexcept
+	//  :     ,    .  
+	//     (buildSectionBuckets ,   )   ,
+	//     ,        ,        .
+	// begin/back     
+	template<typename ForwardIterator, typename GetKey>
+	void innerBuild(ForwardIterator _first, ForwardIterator _last, const BuildOptions& _options, GetKey _getKey, std::forward_iterator_tag)
 	{
-		_first = _last = innerFind(_key, hasher(_key));
-
-		if (_first == endPtr)
-			return;
-
-		while (_last->next && (comp(_last->next->getKey(), _key)))
-			_last = _last->next;
-	}
+		struct BuildItem
+		{
+			ForwardIterator iter;
+			size_t hash;
+		};
 
-	//Insertion---------------------------------------------------------------------------------------------------------------------------------
+		size_t count = static_cast<size_t>(std::distance(_first, _last));
 
-	template<typename KT>
-	NodeType* innerSetInsert(KT&& _key)
-	{
-		size_t hash = hasher(_key);
-		NodeType* newNode = nullptr;
+		resetForBuild();
 
-		if (!isMulti)
+		if ((count / maxLoadFactor) > bucketCount)
 		{
-			//         endPtr
-			if (innerFind(_key, hash) != endPtr)
-				return endPtr;
-
-			newNode = new NodeType(hash, std::forward<KT>(_key));
-
-			placeNewNode(newNode);
+			freeBucketArray(bucketArray, bucketCount);
+			setEmptyBucketArray();
+			allocateBucketArray((count / maxLoadFactor) * 1.1f);
 		}
 		else
 		{
-			NodeType* res = innerFind(_key, hash);
+			clearUsedBuckets();
+		}
 
-			newNode = new NodeType(hash, std::forward<KT>(_key));
+		nodePool.reserve(count);
 
-			if (res != endPtr)
-				placeNewNodeIfSameFound(res, newNode);
-			else
-				placeNewNode(newNode);
+		size_t sectionBuckets = DefProps::buildSectionBuckets;
+		size_t sectionCount = (bucketCount + sectionBuckets - 1) / sectionBuckets;
+
+		// sectionOffsets[i + 1] -    i
+		std::vector<size_t> hashes(count);
+		std::vector<size_t> sectionOffsets(sectionCount + 1, 0);
+
+		size_t position = 0;
+		for (ForwardIterator current = _first; current != _last; ++current, ++position)
+		{
+			hashes[position] = hasher(_getKey(*current));
+			++sectionOffsets[bucketIndex.index(hashes[position]) / sectionBuckets + 1];
 		}
 
-		++elementCount;
-		updateBeginBack(newNode);
-		checkLoadFactor();
+		for (size_t i = 1; i <= sectionCount; ++i)
+			sectionOffsets[i] += sectionOffsets[i - 1];
 
-		return newNode;
-	}
+		//  ,       ,   insert
+		std::vector<BuildItem> items(count);
 
-	template<typename KT, typename VT>
-	NodeType* innerMapInsert(KT&& _key, VT&& _value)
-	{
-		size_t hash = hasher(_key);
-		NodeType* newNode = nullptr;
+		position = 0;
+		for (ForwardIterator current = _first; current != _last; ++current, ++position)
+			items[sectionOffsets[bucketIndex.index(hashes[position]) / sectionBuckets]++] = BuildItem{ current, hashes[position] };
 
-		if (!isMulti)
+		std::vector<size_t>().swap(hashes);
+
+		try
 		{
-			//         endPtr
-			if (innerFind(_key, hash) != endPtr)
-				return endPtr;
+			for (const BuildItem& item : items)
+			{
+				size_t index = bucketIndex.index(item.hash);
+				Bucket& bucket = bucketArray[index];
+				NodeType* res = (_options.uniqueKeys) ? endPtr : findInChain(bucket.head, _getKey(*item.iter), item.hash);
+
+				if (!isMulti && res != endPtr)
+					continue;
+
+				NodeType* newNode = nodePool.create(item.hash, *item.iter);
+
+				if (res != endPtr)
+				{
+					placeNewNodeIfSameFound(res, newNode, item.hash);
+				}
+				else
+				{
+					if (bucket.head)
+					{
+						setChainPrev(bucket.head, newNode);
+						newNode->next = bucket.head;
+					}
 
-			newNode = new NodeType(hash, std::forward<KT>(_key), std::forward<VT>(_value));
+					bucket.head = newNode;
+					markUsedBucket(index);
+				}
 
-			placeNewNode(newNode);
+				++elementCount;
+			}
 		}
-		else
+		catch (...)
 		{
-			NodeType* res = innerFind(_key, hash);
+			//      , begin/back   
+			loadFactor = currentLoadFactor();
+			setBeginBack();
+			throw;
+		}
 
-			newNode = new NodeType(hash, std::forward<KT>(_key), std::forward<VT>(_value));
+		loadFactor = currentLoadFactor();
+		setBeginBack();
+	}
 
-			if (res != endPtr)
-				placeNewNodeIfSameFound(res, newNode);
-			else
-				placeNewNode(newNode);
-		}
+	//Erasing-----------------------------------------------------------------------------------------------------------------------------------
 
-		++elementCount;
-		updateBeginBack(newNode);
-		checkLoadFactor();
+	//      _key,      
+	template<typename K>
+	size_t innerEraseKey(const K& _key)
+	{
+		size_t hash = hasher(_key);
+		NodeType* prev = nullptr;
 
-		return newNode;
+		for (NodeType* current = locateBucket(hash).head; current; current = current->next)
+		{
+			if (current->matchHash(hash) && comp(_key, current->getKey()))
+				return eraseSingleNode(current, prev);
+
+			prev = current;
+		}
+
+		return 0;
 	}
 
-	template<typename Pair>
-	NodeType* innerMapPairInsert(Pair&& _pair)
+	template<typename K>
+	size_t innerEraseEqual(const K& _key)
 	{
-		size_t hash = hasher(_pair.first);
-		NodeType* newNode = nullptr;
+		NodeType* first = nullptr;
+		NodeType* last = nullptr;
 
-		if (!isMulti)
-		{
-			//         endPtr
-			if (innerFind(_pair.first, hash) != endPtr)
-				return endPtr;
+		markEqualRange(_key, first, last);
 
-			newNode = new NodeType(hash, std::forward<Pair>(_pair));
+		if (first == endPtr)
+			return 0;
 
-			placeNewNode(newNode);
-		}
-		else
-		{
-			NodeType* res = innerFind(_pair.first, hash);
+		//  equal    ,        
+		NodeType* groupPrev = chainPrev(first, nodeHash(first));
+		size_t count = 0;
+		NodeType* current = nullptr;
 
-			newNode = new NodeType(hash, std::forward<Pair>(_pair));
+		while (first != last)
+		{
+			current = first;
+			first = first->next;
 
-			if (res != endPtr)
-				placeNewNodeIfSameFound(res, newNode);
-			else
-				placeNewNode(newNode);
+			count += eraseSingleNode(current, groupPrev);
 		}
 
-		++elementCount;
-		updateBeginBack(newNode);
-		checkLoadFactor();
+		return count + eraseSingleNode(last, groupPrev);
+	};
 
-		return newNode;
+	size_t eraseSingleNode(NodeType* _node)
+	{
+		return eraseSingleNode(_node, chainPrev(_node, nodeHash(_node)));
 	}
 
-	//Erasing-----------------------------------------------------------------------------------------------------------------------------------
-
-	size_t eraseSingleNode(NodeType* _node)
+	// _prev -   (nullptr,  _node   )
+	size_t eraseSingleNode(NodeType* _node, NodeType* _prev)
 	{
-		if (_node->prev)
+		if (_prev)
 		{
-			_node->prev->next = _node->next;
+			_prev->next = _node->next;
 		}
 		else
 		{
-			bucketArray[_node->hash % bucketCount].head = _node->next;
+			locateBucket(nodeHash(_node)).head = _node->next;
 
 			if (_node == beginPtr)
 				toNext(beginPtr);
@@ -443,18 +1622,24 @@ protected:
 
 		if (_node->next)
 		{
-			_node->next->prev = _node->prev;
+			setChainPrev(_node->next, _prev);
 		}
 		else 
 		{
+			// _node    ,         _prev
 			if (_node == backPtr)
-				toPrev(backPtr);
+			{
+				if (_prev)
+					backPtr = _prev;
+				else
+					toPrev(backPtr);
+			}
 
 			if (backPtr == _node) //  backPtr  ,   ,   
 				backPtr = nullptr;
 		}
 
-		delete _node;
+		nodePool.destroy(_node);
 		--elementCount;
 		checkLoadFactor();
 
@@ -503,14 +1688,10 @@ protected:
 		}
 
 		//       _current
-		for (size_t i = (_current->hash % bucketCount + 1); i < bucketCount; ++i)
-		{
-			if (bucketArray[i].head)
-			{
-				_current = bucketArray[i].head;
-				return;
-			}
-		}
+		NodeType* next = firstNodeFrom(iterationIndex(nodeHash(_current)) + 1);
+
+		if (next)
+			_current = next;
 	}
 
 	void toPrev(NodeType*& _current) const noexcept
@@ -530,33 +1711,19 @@ protected:
 			return;
 		}
 
-		if (_current->prev)
-		{
-			_current = _current->prev;
-			return;
-		}
+		size_t hash = nodeHash(_current);
+		NodeType* chainPrevNode = chainPrev(_current, hash);
 
-		for (size_t i = (_current->hash % bucketCount - 1); i > 0; --i)
+		if (chainPrevNode)
 		{
-			if (bucketArray[i].head)
-			{
-				_current = bucketArray[i].head;
-
-				while (_current->next)
-					_current = _current->next;
-
-				return;
-			}
+			_current = chainPrevNode;
+			return;
 		}
 
-		//   0 , .     
-		if (bucketArray[0].head)
-		{
-			_current = bucketArray[0].head;
+		NodeType* prev = lastNodeBefore(iterationIndex(hash));
 
-			while (_current->next)
-				_current = _current->next;
-		}
+		if (prev)
+			_current = prev;
 	}
 
 //Public Methods--------------------------------------------------------------------------------------------------------------------------------
@@ -594,17 +1761,115 @@ public:
 		return gainFactor;
 	}
 
+	float getMinLoadFactor() const noexcept
+	{
+		return minLoadFactor;
+	}
+
+	Allocator getAllocator() const noexcept
+	{
+		return nodePool.getAllocator();
+	}
+
+	//     (     ),  -   ,
+	//      .      
+	HashTableMemoryUsage getMemoryUsage() const noexcept
+	{
+		HashTableMemoryUsage usage;
+		usage.bucketBytes = (bucketAllocationSize(bucketCount) + (oldBucketArray ? bucketAllocationSize(oldBucketCount) : 0)) * sizeof(Bucket);
+		usage.nodeBytes = nodePool.getAllocatedBytes();
+		usage.payloadBytes = elementCount * sizeof(typename NodeType::PayloadType);
+		usage.totalBytes = usage.bucketBytes + usage.nodeBytes;
+
+		return usage;
+	}
+
+	bool isIncrementalRehash() const noexcept
+	{
+		return incrementalRehash;
+	}
+
+	bool isRehashing() const noexcept
+	{
+		return oldBucketArray != nullptr;
+	}
+
+	size_t getRehashStep() const noexcept
+	{
+		return rehashStep;
+	}
+
+	bool isParallelRehash() const noexcept
+	{
+		return parallelRehash;
+	}
+
+	size_t getParallelRehashThreshold() const noexcept
+	{
+		return parallelRehashThreshold;
+	}
+
+	size_t getRehashThreadCount() const noexcept
+	{
+		return rehashThreadCount;
+	}
+
+#ifdef BHT_ENABLE_STATS
+	//   (O(bucketCount + size())),    ,     
+	HashTableStats getStats() const
+	{
+		HashTableStats stats;
+		stats.elementCount = elementCount;
+		stats.bucketCount = visitUnitCount();
+		stats.nodeMemoryBytes = nodePool.getAllocatedBytes();
+
+		for (size_t i = 0; i < stats.bucketCount; ++i)
+		{
+			size_t chainLength = 0;
+
+			for (NodeType* current = (i < bucketCount) ? bucketArray[i].head : oldBucketArray[migratedBucketCount + i - bucketCount].head;
+				current; current = current->next)
+			{
+				++chainLength;
+			}
+
+			if (chainLength >= stats.chainLengthHistogram.size())
+				stats.chainLengthHistogram.resize(chainLength + 1, 0);
+
+			++stats.chainLengthHistogram[chainLength];
+		}
+
+		stats.emptyBucketCount = stats.chainLengthHistogram.empty() ? 0 : stats.chainLengthHistogram[0];
+		stats.maxChainLength = stats.chainLengthHistogram.empty() ? 0 : stats.chainLengthHistogram.size() - 1;
+
+		statsCounters.fill(stats);
+
+		return stats;
+	}
+
+	//     
+	void resetStats() noexcept
+	{
+		statsCounters.reset();
+	}
+#endif
+
 	//Setting Properties------------------------------------------------------------------------------------------------------------------------
 
 	void reserve(size_t _requiredElementCount) noexcept
 	{
 		// maxElementCount = bucketCount * maxLoadFactor
 
+		//       
+		if (_requiredElementCount > elementCount)
+			nodePool.reserve(_requiredElementCount - elementCount);
+
 		//       _requiredElementCount,   
 		if ((_requiredElementCount / maxLoadFactor) <= bucketCount)
 			return;
 
 		//  ,    10%     _requiredElementCount
+		// (    ,  IndexPolicy)
 		reCreate((_requiredElementCount / maxLoadFactor) * 1.1f);
 		checkLoadFactor();
 	}
@@ -615,7 +1880,7 @@ public:
 		if (_newBucketCount <= (elementCount / maxLoadFactor))
 			return false;
 
-		//  ,    10%  
+		//  ,    10%  (     IndexPolicy)
 		reCreate(_newBucketCount * 1.1f);
 		checkLoadFactor();
 		return true;
@@ -624,7 +1889,7 @@ public:
 	bool setMaxLoadFactor(float _newMaxLoadFactor) noexcept
 	{
 		// MaxLoadFactor     0.0
-		if (_newMaxLoadFactor <= 0.0f)
+		if (_newMaxLoadFactor <= 0.0f || !isValidMinLoadFactor(minLoadFactor, _newMaxLoadFactor, gainFactor))
 			return false;
 
 		maxLoadFactor = _newMaxLoadFactor;
@@ -635,33 +1900,89 @@ public:
 	bool setGainFactor(float _newGainFactor) noexcept
 	{
 		// gainFactor     0.0
-		if (_newGainFactor <= 0.0f)
+		if (_newGainFactor <= 0.0f || !isValidMinLoadFactor(minLoadFactor, maxLoadFactor, _newGainFactor))
 			return false;
 
 		gainFactor = _newGainFactor;
 		return true;
 	}
 
+	//  loadFactor    minLoadFactor,   . 0  
+	bool setMinLoadFactor(float _newMinLoadFactor) noexcept
+	{
+		if (!isValidMinLoadFactor(_newMinLoadFactor, maxLoadFactor, gainFactor))
+			return false;
+
+		minLoadFactor = _newMinLoadFactor;
+		checkShrink();
+		return true;
+	}
+
+	void setIncrementalRehash(bool _enabled) noexcept
+	{
+		incrementalRehash = _enabled;
+
+		//        
+		if (!incrementalRehash)
+			finishRehash();
+	}
+
+	bool setRehashStep(size_t _newRehashStep) noexcept
+	{
+		//         
+		if (_newRehashStep == 0)
+			return false;
+
+		rehashStep = _newRehashStep;
+		return true;
+	}
+
+	void setParallelRehash(bool _enabled) noexcept
+	{
+		parallelRehash = _enabled;
+	}
+
+	void setParallelRehashThreshold(size_t _newThreshold) noexcept
+	{
+		parallelRehashThreshold = _newThreshold;
+	}
+
+	// 0 -   
+	void setRehashThreadCount(size_t _newThreadCount) noexcept
+	{
+		rehashThreadCount = _newThreadCount;
+	}
+
+	void finishRehash() noexcept
+	{
+		if (oldBucketArray)
+			migrateBuckets(oldBucketCount - migratedBucketCount);
+	}
+
 	//Modifying---------------------------------------------------------------------------------------------------------------------------------
 
 	void clear()
 	{
-		NodeType* current = nullptr;
-		NodeType* prev = nullptr;
+		//  (   ),     .
+		//   ,    
+		bool isSparse = bucketCount > DefProps::sparseClearMinBuckets && bucketCount / DefProps::sparseClearRatio > elementCount;
 
-		//   
-		for (size_t i = 0; i < bucketCount; ++i)
-		{
-			current = bucketArray[i].head;
-			while (current)
-			{
-				prev = current;
-				current = current->next;
+		destroyAllNodes();
 
-				delete prev;
-			}
+		if (isSparse && minLoadFactor != 0.0f)
+		{
+			freeBucketArray(bucketArray, bucketCount);
+			setEmptyBucketArray();
+		}
+		else
+		{
+			clearUsedBuckets();
 		}
 
+		freeBucketArray(oldBucketArray, oldBucketCount);
+		oldBucketArray = nullptr;
+		oldBucketCount = migratedBucketCount = 0;
+
 		elementCount = 0;
 		beginPtr = backPtr = nullptr;
 		checkLoadFactor();
@@ -669,9 +1990,12 @@ public:
 
 	void shrinkToFit() noexcept
 	{
+		//            
 		if (elementCount == 0)
 		{
-			reCreate(DefProps::deafaultBucketCount());
+			clear();
+			freeBucketArray(bucketArray, bucketCount);
+			setEmptyBucketArray();
 			return;
 		}
 
@@ -706,12 +2030,35 @@ public:
 		_other.loadFactor = tempLoadFactor;
 		_other.maxLoadFactor = tempMaxLoadFactor;
 		_other.gainFactor = tempGainFactor;
+
+		std::swap(bucketIndex, _other.bucketIndex);
+		std::swap(oldBucketIndex, _other.oldBucketIndex);
+		std::swap(oldBucketArray, _other.oldBucketArray);
+		std::swap(oldBucketCount, _other.oldBucketCount);
+		std::swap(migratedBucketCount, _other.migratedBucketCount);
+		std::swap(minLoadFactor, _other.minLoadFactor);
+		std::swap(rehashStep, _other.rehashStep);
+		std::swap(incrementalRehash, _other.incrementalRehash);
+		std::swap(parallelRehash, _other.parallelRehash);
+		std::swap(parallelRehashThreshold, _other.parallelRehashThreshold);
+		std::swap(rehashThreadCount, _other.rehashThreadCount);
+
+		nodePool.swap(_other.nodePool);
 	}
 
 	void merge(HashTable& _source) noexcept
 	{
 		NodeType* current = nullptr;
 		NodeType* prev = nullptr;
+		size_t keptCount = 0; // ,   _source
+
+		//  _source         ,     
+		nodePool.adopt(_source.nodePool);
+		_source.finishRehash();
+		_source.beginPtr = _source.backPtr = nullptr;
+
+		if (_source.elementCount != 0)
+			ensureBucketArray();
 
 		if (!isMulti)
 		{
@@ -726,14 +2073,33 @@ public:
 					prev = current;
 					current = current->next;
 
-					if (!innerFind(prev->getKey(), prev->hash))
+					size_t hash = nodeHash(prev);
+
+					if (innerFind(prev->getKey(), hash) == endPtr)
 					{
-						placeExistNode(prev);
+						setChainPrev(prev, nullptr);
+						prev->next = nullptr;
+						placeNewNode(prev, hash);
 
 						++elementCount;
 						updateBeginBack(prev);
+						migrateBuckets();
 						checkLoadFactor();
 					}
+					else
+					{
+						//      ,     _source.      
+						// ,         _source     
+						NodeType* keptNode = _source.nodePool.create(std::move(*prev));
+						nodePool.destroy(prev);
+
+						_source.setChainPrev(keptNode, nullptr);
+						keptNode->next = nullptr;
+						_source.placeNewNode(keptNode, hash);
+
+						++keptCount;
+						_source.updateBeginBack(keptNode);
+					}
 				}
 			}
 		}
@@ -750,28 +2116,27 @@ public:
 					prev = current;
 					current = current->next;
 
-					NodeType* res = innerFind(prev->getKey(), prev->hash); //  equal 
+					size_t hash = nodeHash(prev);
+					NodeType* res = innerFind(prev->getKey(), hash); //  equal 
+
+					setChainPrev(prev, nullptr);
+					prev->next = nullptr;
 
 					if (res != endPtr)
-					{
-						prev->prev = prev->next = nullptr;
-						placeNewNodeIfSameFound(res, prev);
-					}
+						placeNewNodeIfSameFound(res, prev, hash);
 					else
-					{
-						placeExistNode(prev);
-					}
+						placeNewNode(prev, hash);
 
 					++elementCount;
 					updateBeginBack(prev);
+					migrateBuckets();
 					checkLoadFactor();
 				}
 			}
 		}
 
-		_source.elementCount = 0;
-		_source.loadFactor = 0.0f;
-		_source.beginPtr = _source.backPtr = nullptr;
+		_source.elementCount = keptCount;
+		_source.loadFactor = _source.currentLoadFactor();
 	}
 
 	//Search------------------------------------------------------------------------------------------------------------------------------------
@@ -781,52 +2146,55 @@ public:
 		return innerFind(_key, hasher(_key)) != endPtr;
 	}
 
-	size_t countByKey(const KeyType& _key) const noexcept
+	template<typename K, typename = EnableTransparentLookup<Hasher, EqualComp, K>>
+	bool contains(const K& _key) const noexcept
 	{
-		NodeType* current = innerFind(_key, hasher(_key));
-		size_t count = 0;
+		return innerFind(_key, hasher(_key)) != endPtr;
+	}
 
-		if (current == endPtr)
-			return 0;
+	//    _count    _results,     .   
+	size_t containsBatch(const KeyType* _keys, size_t _count, bool* _results) const noexcept
+	{
+		size_t found = 0;
 
-		while (current)
-		{
-			if (comp(current->getKey(), _key))
+		innerFindBatch(_keys, _count, [this, &found, &_results](NodeType* _node)
 			{
-				++count;
-				current = current->next;
-			}
-			else break;
-		}
+				*_results = (_node != endPtr);
+				found += *_results++;
+			});
 
-		return count;
+		return found;
 	}
 
-	//Erasing-----------------------------------------------------------------------------------------------------------------------------------
-
-	size_t eraseEqual(const KeyType& _key)
+	size_t countByKey(const KeyType& _key) const noexcept
 	{
-		NodeType* first = nullptr;
-		NodeType* last = nullptr;
+		return innerCountByKey(_key);
+	}
 
-		markEqualRange(_key, first, last);
+	template<typename K, typename = EnableTransparentLookup<Hasher, EqualComp, K>>
+	size_t countByKey(const K& _key) const noexcept
+	{
+		return innerCountByKey(_key);
+	}
 
-		if (first == endPtr)
-			return 0;
+	//Erasing-----------------------------------------------------------------------------------------------------------------------------------
 
-		size_t count = 0;
-		NodeType* current = nullptr;
+	size_t eraseEqual(const KeyType& _key)
+	{
+		size_t count = innerEraseEqual(_key);
+		checkShrink();
 
-		while (first != last)
-		{
-			current = first;
-			first = first->next;
+		return count;
+	}
 
-			count += eraseSingleNode(current);
-		}
+	template<typename K, typename = EnableTransparentLookup<Hasher, EqualComp, K>>
+	size_t eraseEqual(const K& _key)
+	{
+		size_t count = innerEraseEqual(_key);
+		checkShrink();
 
-		return count + eraseSingleNode(last);
-	};
+		return count;
+	}
 };
 
 #endif
@@ -0,0 +1,369 @@
+//   HashMap, HashMultiMap, HashSet, HashMultiSet     STL.
+//
+// (  code): g++ -O2 -std=c++17 -DNDEBUG HashTableBenchmarks.cpp -o HashTableBenchmarks
+//
+// ( ,   ):
+//   --containers=HashMap,HashMultiMap,HashSet,HashMultiSet,std::unordered_map,std::unordered_multimap,
+//                std::unordered_set,std::unordered_multiset
+//   --types=u64,u64-struct64,shortstring,longstring,struct64        -: u64 - uint64_t, shortstring - 
+//                                                                     SSO(12 ), longstring - 48 ,
+//                                                                    struct64 - 64- .  - uint64_t,
+//                                                                     u64-struct64 - 64- 
+//   --sizes=1K,64K,1M                                                 ,  K  M,  100M
+//   --distributions=uniform,sequential,zipfian
+//   --hit=1,0.5,0                                                       
+//   --operations=insert,find,iterate,erase
+//   --repeats=5                                                         
+//   --csv                                                               CSV
+//
+//       reserve.  -     :
+// ,  ,     .   multi   ,
+//        
+
+#include <cstdio>
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "HashMap.h"
+#include "HashSet.h"
+#include "BenchmarkUtils.h"
+
+using namespace BenchmarkUtils;
+
+namespace
+{
+	template<typename KeyType>
+	struct HasherFor
+	{
+		using type = std::hash<KeyType>;
+	};
+
+	template<>
+	struct HasherFor<Struct64>
+	{
+		using type = Struct64Hash;
+	};
+
+	//Subjects----------------------------------------------------------------------------------------------------------------------------------
+
+	//     . _IsMap -    , _IsStd -   STL
+	template<typename Container, bool _IsMap, bool _IsStd>
+	struct Subject;
+
+	template<typename Container>
+	struct Subject<Container, true, false>
+	{
+		template<typename KeyType, typename ValueType>
+		static void insert(Container& _container, const KeyType& _key, const ValueType& _value)
+		{
+			_container.insert(_key, _value);
+		}
+
+		template<typename KeyType>
+		static bool contains(const Container& _container, const KeyType& _key)
+		{
+			return _container.contains(_key);
+		}
+	};
+
+	template<typename Container>
+	struct Subject<Container, false, false>
+	{
+		template<typename KeyType, typename ValueType>
+		static void insert(Container& _container, const KeyType& _key, const ValueType&)
+		{
+			_container.insert(_key);
+		}
+
+		template<typename KeyType>
+		static bool contains(const Container& _container, const KeyType& _key)
+		{
+			return _container.contains(_key);
+		}
+	};
+
+	template<typename Container>
+	struct Subject<Container, true, true>
+	{
+		template<typename KeyType, typename ValueType>
+		static void insert(Container& _container, const KeyType& _key, const ValueType& _value)
+		{
+			_container.emplace(_key, _value);
+		}
+
+		template<typename KeyType>
+		static bool contains(const Container& _container, const KeyType& _key)
+		{
+			return _container.find(_key) != _container.end();
+		}
+	};
+
+	template<typename Container>
+	struct Subject<Container, false, true>
+	{
+		template<typename KeyType, typename ValueType>
+		static void insert(Container& _container, const KeyType& _key, const ValueType&)
+		{
+			_container.insert(_key);
+		}
+
+		template<typename KeyType>
+		static bool contains(const Container& _container, const KeyType& _key)
+		{
+			return _container.find(_key) != _container.end();
+		}
+	};
+
+	//Options-----------------------------------------------------------------------------------------------------------------------------------
+
+	struct Options
+	{
+		std::vector<std::string> containers;
+		std::vector<std::string> types;
+		std::vector<size_t> sizes;
+		std::vector<Distribution> distributions;
+		std::vector<double> hitRatios;
+		std::vector<std::string> operations;
+		size_t repeats = 5;
+		bool isCsv = false;
+	};
+
+	Options parseOptions(int _argc, char** _argv)
+	{
+		Options options;
+
+		options.containers = splitList(getArgument(_argc, _argv, "containers",
+			"HashMap,HashMultiMap,HashSet,HashMultiSet,std::unordered_map,std::unordered_multimap,std::unordered_set,std::unordered_multiset"));
+		options.types = splitList(getArgument(_argc, _argv, "types", "u64,u64-struct64,shortstring,longstring,struct64"));
+		options.operations = splitList(getArgument(_argc, _argv, "operations", "insert,find,iterate,erase"));
+
+		for (const std::string& size : splitList(getArgument(_argc, _argv, "sizes", "1K,64K,1M")))
+			options.sizes.push_back(std::max<size_t>(parseSize(size), 1));
+
+		for (const std::string& distribution : splitList(getArgument(_argc, _argv, "distributions", "uniform,sequential,zipfian")))
+		{
+			if (distribution == "uniform")
+				options.distributions.push_back(Distribution::Uniform);
+			else if (distribution == "sequential")
+				options.distributions.push_back(Distribution::Sequential);
+			else if (distribution == "zipfian")
+				options.distributions.push_back(Distribution::Zipfian);
+			else
+				std::fprintf(stderr, "Unknown distribution: %s\n", distribution.c_str());
+		}
+
+		for (const std::string& ratio : splitList(getArgument(_argc, _argv, "hit", "1,0.5,0")))
+			options.hitRatios.push_back(std::min(std::max(std::atof(ratio.c_str()), 0.0), 1.0));
+
+		options.repeats = std::max<size_t>(parseSize(getArgument(_argc, _argv, "repeats", "5")), 1);
+		options.isCsv = hasFlag(_argc, _argv, "csv");
+
+		return options;
+	}
+
+	//Measuring---------------------------------------------------------------------------------------------------------------------------------
+
+	//   (, , ),    
+	template<typename KeyType, typename ValueType>
+	struct CaseData
+	{
+		const char* typeName;
+		Distribution distribution;
+		std::vector<KeyType> keys;                      //   
+		std::vector<ValueType> values;
+		std::vector<KeyType> eraseKeys;                 //      
+		std::vector<std::vector<KeyType>> lookupKeys;   //      
+	};
+
+	void printHeader(const Options& _options)
+	{
+		if (_options.isCsv)
+			std::printf("container,type,distribution,size,operation,hit,mean_ns,stddev_ns,min_ns,max_ns\n");
+		else
+			std::printf("%-24s %-14s %-11s %10s %-8s %5s %10s %9s %10s %10s\n",
+				"container", "type", "dist", "size", "op", "hit", "mean ns", "stddev", "min", "max");
+	}
+
+	void printRow(const Options& _options, const std::string& _container, const char* _type, Distribution _distribution,
+		size_t _size, const char* _operation, const std::string& _hit, const Summary& _summary)
+	{
+		const char* format = _options.isCsv ? "%s,%s,%s,%zu,%s,%s,%.2f,%.2f,%.2f,%.2f\n" :
+			"%-24s %-14s %-11s %10zu %-8s %5s %10.2f %9.2f %10.2f %10.2f\n";
+
+		std::printf(format, _container.c_str(), _type, distributionName(_distribution), _size, _operation, _hit.c_str(),
+			_summary.mean, _summary.stddev, _summary.min, _summary.max);
+		std::fflush(stdout);
+	}
+
+	template<typename Container, bool _IsMap, bool _IsStd, typename KeyType, typename ValueType>
+	void measureContainer(const Options& _options, const std::string& _name, const CaseData<KeyType, ValueType>& _data)
+	{
+		using Ops = Subject<Container, _IsMap, _IsStd>;
+
+		if (!listContains(_options.containers, _name))
+			return;
+
+		size_t size = _data.keys.size();
+
+		std::vector<double> insertSamples, iterateSamples, eraseSamples;
+		std::vector<std::vector<double>> findSamples(_data.lookupKeys.size());
+
+		for (size_t repeat = 0; repeat < _options.repeats; ++repeat)
+		{
+			Container container;
+
+			Clock::time_point begin = Clock::now();
+			for (size_t i = 0; i < size; ++i)
+				Ops::insert(container, _data.keys[i], _data.values[i]);
+			Clock::time_point end = Clock::now();
+
+			insertSamples.push_back(elapsedNanoseconds(begin, end) / size);
+
+			for (size_t h = 0; h < _data.lookupKeys.size(); ++h)
+			{
+				const std::vector<KeyType>& lookupKeys = _data.lookupKeys[h];
+				size_t foundCount = 0;
+
+				begin = Clock::now();
+				for (const KeyType& key : lookupKeys)
+					foundCount += Ops::contains(container, key);
+				end = Clock::now();
+
+				doNotOptimize(foundCount);
+				findSamples[h].push_back(elapsedNanoseconds(begin, end) / lookupKeys.size());
+			}
+
+			size_t visitedCount = 0;
+
+			begin = Clock::now();
+			for (const auto& elem : container)
+			{
+				doNotOptimize(elem);
+				++visitedCount;
+			}
+			end = Clock::now();
+
+			doNotOptimize(visitedCount);
+			iterateSamples.push_back(elapsedNanoseconds(begin, end) / size);
+
+			size_t erasedCount = 0;
+
+			begin = Clock::now();
+			for (const KeyType& key : _data.eraseKeys)
+				erasedCount += container.erase(key);
+			end = Clock::now();
+
+			doNotOptimize(erasedCount);
+			eraseSamples.push_back(elapsedNanoseconds(begin, end) / size);
+		}
+
+		if (listContains(_options.operations, "insert"))
+			printRow(_options, _name, _data.typeName, _data.distribution, size, "insert", "-", summarize(insertSamples));
+
+		if (listContains(_options.operations, "find"))
+		{
+			for (size_t h = 0; h < findSamples.size(); ++h)
+			{
+				char hit[16];
+				std::snprintf(hit, sizeof(hit), "%.2g", _options.hitRatios[h]);
+
+				printRow(_options, _name, _data.typeName, _data.distribution, size, "find", hit, summarize(findSamples[h]));
+			}
+		}
+
+		if (listContains(_options.operations, "iterate"))
+			printRow(_options, _name, _data.typeName, _data.distribution, size, "iterate", "-", summarize(iterateSamples));
+
+		if (listContains(_options.operations, "erase"))
+			printRow(_options, _name, _data.typeName, _data.distribution, size, "erase", "-", summarize(eraseSamples));
+	}
+
+	//        . _makeKey  _makeValue      id
+	template<typename KeyType, typename ValueType, typename MakeKey, typename MakeValue>
+	void runCase(const Options& _options, const char* _typeName, size_t _size, Distribution _distribution,
+		MakeKey _makeKey, MakeValue _makeValue)
+	{
+		using Hasher = typename HasherFor<KeyType>::type;
+
+		CaseData<KeyType, ValueType> data;
+		data.typeName = _typeName;
+		data.distribution = _distribution;
+
+		std::vector<uint64_t> ids = makeInsertIds(_size, _distribution);
+		data.keys.reserve(_size);
+		data.values.reserve(_size);
+
+		for (uint64_t id : ids)
+		{
+			data.keys.push_back(_makeKey(id));
+			data.values.push_back(_makeValue(id));
+		}
+
+		data.eraseKeys = data.keys;
+		std::shuffle(data.eraseKeys.begin(), data.eraseKeys.end(), std::mt19937_64(_size));
+
+		//   2^20 ,          
+		size_t lookupCount = std::min<size_t>(std::max<size_t>(_size, size_t(1) << 20), size_t(1) << 24);
+
+		for (double hitRatio : _options.hitRatios)
+		{
+			std::vector<KeyType> lookupKeys;
+			lookupKeys.reserve(lookupCount);
+
+			for (uint64_t id : makeLookupIds(_size, lookupCount, _distribution, hitRatio, _size + data.lookupKeys.size()))
+				lookupKeys.push_back(_makeKey(id));
+
+			data.lookupKeys.push_back(std::move(lookupKeys));
+		}
+
+		measureContainer<HashMap<KeyType, ValueType, Hasher>, true, false>(_options, "HashMap", data);
+		measureContainer<HashMultiMap<KeyType, ValueType, Hasher>, true, false>(_options, "HashMultiMap", data);
+		measureContainer<HashSet<KeyType, Hasher>, false, false>(_options, "HashSet", data);
+		measureContainer<HashMultiSet<KeyType, Hasher>, false, false>(_options, "HashMultiSet", data);
+		measureContainer<std::unordered_map<KeyType, ValueType, Hasher>, true, true>(_options, "std::unordered_map", data);
+		measureContainer<std::unordered_multimap<KeyType, ValueType, Hasher>, true, true>(_options, "std::unordered_multimap", data);
+		measureContainer<std::unordered_set<KeyType, Hasher>, false, true>(_options, "std::unordered_set", data);
+		measureContainer<std::unordered_multiset<KeyType, Hasher>, false, true>(_options, "std::unordered_multiset", data);
+	}
+
+	void runType(const Options& _options, const std::string& _type, size_t _size, Distribution _distribution)
+	{
+		auto makeU64 = [](uint64_t _id) { return KeyMaker<uint64_t>::make(_id); };
+		auto makeStruct64 = [](uint64_t _id) { return KeyMaker<Struct64>::make(_id); };
+		auto makeShortString = [](uint64_t _id) { return KeyMaker<std::string>::make(_id, 12); };
+		auto makeLongString = [](uint64_t _id) { return KeyMaker<std::string>::make(_id, 48); };
+
+		if (_type == "u64")
+			runCase<uint64_t, uint64_t>(_options, "u64", _size, _distribution, makeU64, makeU64);
+		else if (_type == "u64-struct64")
+			runCase<uint64_t, Struct64>(_options, "u64-struct64", _size, _distribution, makeU64, makeStruct64);
+		else if (_type == "shortstring")
+			runCase<std::string, uint64_t>(_options, "shortstring", _size, _distribution, makeShortString, makeU64);
+		else if (_type == "longstring")
+			runCase<std::string, uint64_t>(_options, "longstring", _size, _distribution, makeLongString, makeU64);
+		else if (_type == "struct64")
+			runCase<Struct64, uint64_t>(_options, "struct64", _size, _distribution, makeStruct64, makeU64);
+		else
+			std::fprintf(stderr, "Unknown type: %s\n", _type.c_str());
+	}
+}
+
+int main(int _argc, char** _argv)
+{
+	Options options = parseOptions(_argc, _argv);
+
+	printHeader(options);
+
+	for (const std::string& type : options.types)
+	{
+		for (size_t size : options.sizes)
+		{
+			for (Distribution distribution : options.distributions)
+				runType(options, type, size, distribution);
+		}
+	}
+
+	return 0;
+}
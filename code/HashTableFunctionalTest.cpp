@@ -0,0 +1,669 @@
+//   HashMap  HashSet    (Storage)  multi :  ,
+//            (std::unordered_map,
+// std::unordered_multimap, std::unordered_set, std::unordered_multiset),    .  
+//  , , swap, build  merge.      build 
+//     :    ,       .
+//    AddressSanitizer  UndefinedBehaviorSanitizer.
+//
+// (  code): g++ -O1 -g -std=c++17 -fsanitize=address,undefined -pthread HashTableFunctionalTest.cpp -o HashTableFunctionalTest
+//
+// ( ):
+//   --ops=20K                                ,  K  M
+//   --keys=2K                             ,  K  M
+//   --seed=1                                
+//
+//   0,    ,  1      stderr
+
+#include <cstdio>
+#include <cstdlib>
+#include <algorithm>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "HashMap.h"
+#include "HashSet.h"
+#include "BenchmarkUtils.h"
+
+using namespace BenchmarkUtils;
+
+namespace
+{
+	size_t failureCount = 0;
+	const char* currentTest = "";
+
+	// assert  :     NDEBUG
+	void check(bool _condition, const char* _description)
+	{
+		if (!_condition && failureCount++ < 10)
+			std::fprintf(stderr, "check failed(%s): %s\n", currentTest, _description);
+	}
+
+	struct TestSettings
+	{
+		size_t opCount = 0;
+		size_t keyCount = 0;
+		size_t seed = 0;
+	};
+
+	template<typename Storage>
+	using TestMap = HashMap<size_t, std::string, std::hash<size_t>, std::equal_to<size_t>, Storage>;
+
+	template<typename Storage>
+	using TestMultiMap = HashMultiMap<size_t, std::string, std::hash<size_t>, std::equal_to<size_t>, Storage>;
+
+	template<typename Storage>
+	using TestSet = HashSet<size_t, std::hash<size_t>, std::equal_to<size_t>, Storage>;
+
+	template<typename Storage>
+	using TestMultiSet = HashMultiSet<size_t, std::hash<size_t>, std::equal_to<size_t>, Storage>;
+
+	//Entries---------------------------------------------------------------------------------------------------------------------------------
+
+	//         :  -  Map,   Set
+	using MapEntry = std::pair<size_t, std::string>;
+	using SetEntry = size_t;
+
+	MapEntry entryOf(const std::pair<const size_t, std::string>& _pair)
+	{
+		return MapEntry(_pair.first, _pair.second);
+	}
+
+	SetEntry entryOf(size_t _key)
+	{
+		return _key;
+	}
+
+	size_t keyOf(const MapEntry& _entry)
+	{
+		return _entry.first;
+	}
+
+	size_t keyOf(SetEntry _entry)
+	{
+		return _entry;
+	}
+
+	void makeEntry(size_t _key, size_t _value, MapEntry& _entry)
+	{
+		_entry = MapEntry(_key, "value-" + std::to_string(_value));
+	}
+
+	void makeEntry(size_t _key, size_t, SetEntry& _entry)
+	{
+		_entry = _key;
+	}
+
+	template<typename Map>
+	bool insertEntry(Map& _map, const MapEntry& _entry)
+	{
+		return !_map.insert(_entry.first, _entry.second).isEnd();
+	}
+
+	template<typename Set>
+	bool insertEntry(Set& _set, SetEntry _entry)
+	{
+		return !_set.insert(_entry).isEnd();
+	}
+
+	template<typename Reference>
+	using ReferenceEntry = decltype(entryOf(*std::declval<const Reference&>().begin()));
+
+	template<typename Reference>
+	struct IsMultiReference : std::false_type {};
+
+	template<typename... Args>
+	struct IsMultiReference<std::unordered_multimap<Args...>> : std::true_type {};
+
+	template<typename... Args>
+	struct IsMultiReference<std::unordered_multiset<Args...>> : std::true_type {};
+
+	//      ,  _entry( multi       )
+	template<typename Reference, typename Entry>
+	void eraseReferenceEntry(Reference& _reference, const Entry& _entry)
+	{
+		auto range = _reference.equal_range(keyOf(_entry));
+
+		for (auto it = range.first; it != range.second; ++it)
+		{
+			if (entryOf(*it) == _entry)
+			{
+				_reference.erase(it);
+				return;
+			}
+		}
+	}
+
+	//Comparison------------------------------------------------------------------------------------------------------------------------------
+
+	//  :   begin  end   back  beforeBegin  size() 
+	template<typename Container>
+	bool isConsistent(Container& _container)
+	{
+		size_t forwardCount = 0;
+		size_t backwardCount = 0;
+
+		for (auto it = _container.begin(); it != _container.end(); ++it)
+			++forwardCount;
+
+		if (!_container.isEmpty())
+		{
+			for (auto it = _container.back(); it != _container.beforeBegin(); --it)
+				++backwardCount;
+		}
+
+		return forwardCount == _container.size() && backwardCount == _container.size() &&
+			(_container.isEmpty() == (_container.begin() == _container.end()));
+	}
+
+	template<typename Container, typename Reference>
+	bool sameContents(Container& _container, const Reference& _reference)
+	{
+		using Entry = ReferenceEntry<Reference>;
+
+		if (_container.size() != _reference.size() || !isConsistent(_container))
+			return false;
+
+		std::vector<Entry> actual;
+		std::vector<Entry> expected;
+
+		for (auto it = _container.begin(); it != _container.end(); ++it)
+			actual.push_back(entryOf(*it));
+
+		for (const auto& element : _reference)
+			expected.push_back(entryOf(element));
+
+		std::sort(actual.begin(), actual.end());
+		std::sort(expected.begin(), expected.end());
+
+		return actual == expected;
+	}
+
+	//Unique Map Operations-------------------------------------------------------------------------------------------------------------------
+
+	// insertOrAssign, tryEmplace  operator[]    non-multi Map,     
+	template<typename Map, typename Reference>
+	void assignEntry(Map& _map, Reference& _reference, const MapEntry& _entry, size_t _variant, std::true_type)
+	{
+		bool isNew = _reference.count(_entry.first) == 0;
+
+		switch (_variant % 3)
+		{
+		case 0:
+			check(_map.insertOrAssign(_entry.first, _entry.second).second == isNew, "insertOrAssign reports whether the key was new");
+			_reference[_entry.first] = _entry.second;
+			break;
+
+		case 1:
+			check(_map.tryEmplace(_entry.first, _entry.second).second == isNew, "tryEmplace reports whether the key was new");
+			_reference.emplace(_entry.first, _entry.second);
+			break;
+
+		default:
+			_map[_entry.first] = _entry.second;
+			_reference[_entry.first] = _entry.second;
+			break;
+		}
+	}
+
+	template<typename Container, typename Reference, typename Entry>
+	void assignEntry(Container& _container, Reference& _reference, const Entry& _entry, size_t, std::false_type)
+	{
+		insertEntry(_container, _entry);
+		_reference.insert(_entry);
+	}
+
+	//Checks----------------------------------------------------------------------------------------------------------------------------------
+
+	template<typename Container, typename Reference>
+	void checkCopyMoveSwap(Container& _container, const Reference& _reference, size_t _freeKey)
+	{
+		using Entry = ReferenceEntry<Reference>;
+
+		Entry extraEntry;
+		makeEntry(_freeKey, 0, extraEntry);
+
+		Container copy(_container);
+		check(sameContents(copy, _reference), "copy has the contents of the original");
+
+		insertEntry(copy, extraEntry);
+		check(sameContents(_container, _reference), "changing the copy leaves the original untouched");
+
+		Container moved(std::move(copy));
+		check(moved.size() == _reference.size() + 1 && moved.contains(_freeKey), "move constructor takes the contents");
+		check(copy.isEmpty() && isConsistent(copy), "moved-from container is empty");
+
+		insertEntry(copy, extraEntry);
+		check(copy.size() == 1 && copy.contains(_freeKey), "moved-from container accepts new elements");
+
+		//   swap    
+		moved.swap(_container);
+		check(sameContents(moved, _reference) && _container.size() == _reference.size() + 1, "swap exchanges the contents");
+
+		moved.swap(_container);
+		check(sameContents(_container, _reference), "second swap restores the contents");
+	}
+
+	//   build   : non-multi     ,   insert
+	template<typename Container, typename Reference>
+	void checkBuild(Container& _container, Reference& _reference, std::mt19937_64& _random, size_t _keyCount)
+	{
+		using Entry = ReferenceEntry<Reference>;
+
+		std::vector<Entry> input;
+		Reference expected;
+
+		for (size_t i = 0, count = _random() % (_keyCount + 1); i < count; ++i)
+		{
+			Entry entry;
+			makeEntry(_random() % _keyCount, _random(), entry);
+			input.push_back(entry);
+			expected.insert(entry);
+		}
+
+		_container.build(input.begin(), input.end());
+		_reference = expected;
+
+		check(sameContents(_container, _reference), "build keeps the first of equal keys(all of them in multi)");
+	}
+
+	//       : non-multi      
+	template<typename Container, typename Reference>
+	void checkMerge(Container& _container, Reference& _reference, std::mt19937_64& _random, size_t _keyCount)
+	{
+		using Entry = ReferenceEntry<Reference>;
+
+		Container source;
+		Reference sourceReference;
+
+		for (size_t i = 0; i < _keyCount / 4 + 1; ++i)
+		{
+			Entry entry;
+			makeEntry(_random() % (_keyCount * 2), _random(), entry);
+
+			bool isExpected = IsMultiReference<Reference>::value || sourceReference.count(keyOf(entry)) == 0;
+
+			check(insertEntry(source, entry) == isExpected, "insert into the merge source");
+
+			if (isExpected)
+				sourceReference.insert(entry);
+		}
+
+		Reference remaining;
+		std::vector<Entry> movedEntries;
+
+		for (const auto& element : sourceReference)
+		{
+			if (!IsMultiReference<Reference>::value && _reference.count(keyOf(entryOf(element))) != 0)
+				remaining.insert(entryOf(element));
+			else
+				movedEntries.push_back(entryOf(element));
+		}
+
+		for (const Entry& entry : movedEntries)
+			_reference.insert(entry);
+
+		_container.merge(source);
+
+		check(sameContents(_container, _reference), "merge moves the elements with new keys");
+		check(sameContents(source, remaining), "merge leaves the elements with existing keys in the source");
+	}
+
+	//Differential Test-----------------------------------------------------------------------------------------------------------------------
+
+	//       _container   Reference,   
+	template<typename Container, typename Reference>
+	void runDifferential(const char* _name, Container& _container, const TestSettings& _settings, size_t _testIndex)
+	{
+		using Entry = ReferenceEntry<Reference>;
+
+		constexpr bool isMulti = IsMultiReference<Reference>::value;
+		using IsUniqueMap = std::integral_constant<bool, !isMulti && std::is_same<Entry, MapEntry>::value>;
+
+		currentTest = _name;
+
+		std::mt19937_64 random(_settings.seed * 1000 + _testIndex);
+		Reference reference;
+
+		//     keyCount, checkMerge -  keyCount * 2.   checkCopyMoveSwap   
+		size_t freeKey = _settings.keyCount * 2;
+
+		for (size_t op = 0; op < _settings.opCount; ++op)
+		{
+			Entry entry;
+			makeEntry(random() % _settings.keyCount, random(), entry);
+			size_t key = keyOf(entry);
+
+			switch (random() % 10)
+			{
+			case 0:
+			case 1:
+			case 2:
+			{
+				bool isExpected = isMulti || reference.count(key) == 0;
+
+				check(insertEntry(_container, entry) == isExpected, "insert reports whether the element was added");
+
+				if (isExpected)
+					reference.insert(entry);
+
+				break;
+			}
+
+			case 3:
+				assignEntry(_container, reference, entry, random(), IsUniqueMap());
+				break;
+
+			case 4:
+			case 5:
+				if (isMulti)
+					check(_container.eraseEqual(key) == reference.erase(key), "eraseEqual removes every element with the key");
+				else
+					check(_container.erase(key) == reference.erase(key), "erase by key removes the element");
+				break;
+
+			case 6:
+			{
+				auto found = _container.find(key);
+
+				check((found != _container.end()) == (reference.count(key) != 0), "find agrees with the reference");
+				check(_container.contains(key) == (reference.count(key) != 0), "contains agrees with the reference");
+				check(_container.countByKey(key) == reference.count(key), "countByKey agrees with the reference");
+
+				if (!isMulti && found != _container.end())
+					check(entryOf(*found) == entryOf(*reference.find(key)), "find returns the stored element");
+
+				break;
+			}
+
+			case 7:
+				if (!_container.isEmpty())
+				{
+					Entry first = entryOf(*_container.begin());
+
+					check(_container.erase(_container.begin()) == 1, "erase by iterator removes one element");
+					eraseReferenceEntry(reference, first);
+				}
+				break;
+
+			case 8:
+				switch (random() % 100)
+				{
+				case 0:
+					_container.clear();
+					reference.clear();
+					check(_container.isEmpty() && isConsistent(_container), "clear removes every element");
+					break;
+
+				case 1:
+					_container.reserve(_container.size() * 2 + 16);
+					break;
+
+				case 2:
+					_container.shrinkToFit();
+					break;
+				}
+				break;
+
+			default:
+				switch (random() % 100)
+				{
+				case 0:
+					checkCopyMoveSwap(_container, reference, freeKey);
+					break;
+
+				case 1:
+					checkBuild(_container, reference, random, _settings.keyCount);
+					break;
+
+				case 2:
+					checkMerge(_container, reference, random, _settings.keyCount);
+					break;
+				}
+				break;
+			}
+
+			if (op % 1000 == 0)
+				check(sameContents(_container, reference), "contents match the reference");
+		}
+
+		check(sameContents(_container, reference), "contents match the reference at the end");
+
+		checkCopyMoveSwap(_container, reference, freeKey);
+		checkMerge(_container, reference, random, _settings.keyCount);
+		checkBuild(_container, reference, random, _settings.keyCount);
+
+		_container.clear();
+		check(_container.isEmpty() && isConsistent(_container), "clear removes every element");
+	}
+
+	template<typename Container, typename Reference>
+	void runDifferential(const char* _name, const TestSettings& _settings, size_t _testIndex)
+	{
+		Container container;
+		runDifferential<Container, Reference>(_name, container, _settings, _testIndex);
+	}
+
+	//Exception Injection---------------------------------------------------------------------------------------------------------------------
+
+	//   ThrowingValue    copyLimit- (0 -  ).
+	// liveCount   ,    ,       
+	size_t copyCount = 0;
+	size_t copyLimit = 0;
+	long long liveCount = 0;
+
+	struct ThrowingValue
+	{
+		size_t value = 0;
+
+		explicit ThrowingValue(size_t _value) : value(_value)
+		{
+			++liveCount;
+		}
+
+		ThrowingValue(const ThrowingValue& _other) : value(_other.value)
+		{
+			if (copyLimit != 0 && ++copyCount == copyLimit)
+				throw std::runtime_error("copy limit reached");
+
+			++liveCount;
+		}
+
+		ThrowingValue(ThrowingValue&& _other) noexcept : value(_other.value)
+		{
+			++liveCount;
+		}
+
+		ThrowingValue& operator=(const ThrowingValue&) = default;
+		ThrowingValue& operator=(ThrowingValue&&) noexcept = default;
+
+		~ThrowingValue()
+		{
+			--liveCount;
+		}
+	};
+
+	template<typename Map>
+	bool hasValues(Map& _map, size_t _firstKey, size_t _count)
+	{
+		if (_map.size() != _count || !isConsistent(_map))
+			return false;
+
+		for (size_t key = _firstKey; key < _firstKey + _count; ++key)
+		{
+			auto found = _map.find(key);
+
+			if (found == _map.end() || found->second.value != key)
+				return false;
+		}
+
+		return true;
+	}
+
+	template<typename Map>
+	void runExceptionInjection(const char* _name, size_t _elementCount)
+	{
+		currentTest = _name;
+
+		{
+			Map map;
+
+			for (size_t key = 0; key < _elementCount; ++key)
+				map.insert(key, ThrowingValue(key));
+
+			std::vector<std::pair<size_t, ThrowingValue>> input;
+			input.reserve(_elementCount);
+
+			for (size_t key = _elementCount; key < _elementCount * 2; ++key)
+				input.emplace_back(key, ThrowingValue(key));
+
+			const size_t limits[] = { 1, _elementCount / 2, _elementCount };
+
+			for (size_t limit : limits)
+			{
+				bool isThrown = false;
+
+				copyCount = 0;
+				copyLimit = limit;
+
+				try
+				{
+					Map copy(map);
+				}
+				catch (const std::runtime_error&)
+				{
+					isThrown = true;
+				}
+
+				copyLimit = 0;
+
+				check(isThrown, "copy constructor propagates the exception of an element copy");
+				check(hasValues(map, 0, _elementCount), "failed copy leaves the original untouched");
+				check(liveCount == static_cast<long long>(_elementCount * 2), "failed copy destroys every element it copied");
+			}
+
+			for (size_t limit : limits)
+			{
+				bool isThrown = false;
+
+				Map target;
+				target.insert(_elementCount * 3, ThrowingValue(_elementCount * 3));
+
+				copyCount = 0;
+				copyLimit = limit;
+
+				try
+				{
+					target.build(input.begin(), input.end());
+				}
+				catch (const std::runtime_error&)
+				{
+					isThrown = true;
+				}
+
+				copyLimit = 0;
+
+				check(isThrown, "build propagates the exception of an element copy");
+				check(isConsistent(target), "failed build leaves the container consistent");
+				check(liveCount == static_cast<long long>(_elementCount * 2 + target.size()), "failed build leaks no elements");
+
+				target.insert(_elementCount * 4, ThrowingValue(_elementCount * 4));
+				check(target.contains(_elementCount * 4) && isConsistent(target), "container accepts inserts after a failed build");
+
+				target.clear();
+				check(target.isEmpty() && isConsistent(target), "container clears after a failed build");
+			}
+
+			Map copy(map);
+			check(hasValues(copy, 0, _elementCount), "copy without exceptions has every element");
+
+			Map built;
+			built.build(input.begin(), input.end());
+			check(hasValues(built, _elementCount, _elementCount), "build without exceptions has every element");
+		}
+
+		check(liveCount == 0, "every element is destroyed exactly once");
+	}
+
+	template<typename Storage>
+	void runExceptionInjection(const char* _name, size_t _elementCount, std::false_type)
+	{
+		runExceptionInjection<HashMap<size_t, ThrowingValue, std::hash<size_t>, std::equal_to<size_t>, Storage>>(_name, _elementCount);
+	}
+
+	template<typename Storage>
+	void runExceptionInjection(const char* _name, size_t _elementCount, std::true_type)
+	{
+		runExceptionInjection<Storage>(_name, _elementCount, std::false_type());
+		runExceptionInjection<HashMultiMap<size_t, ThrowingValue, std::hash<size_t>, std::equal_to<size_t>, Storage>>(_name, _elementCount);
+	}
+
+	//Storages--------------------------------------------------------------------------------------------------------------------------------
+
+	template<typename Storage>
+	void runStorage(const char* _name, const TestSettings& _settings, size_t& _testIndex, std::false_type)
+	{
+		runDifferential<TestMap<Storage>, std::unordered_map<size_t, std::string>>(_name, _settings, _testIndex++);
+		runDifferential<TestSet<Storage>, std::unordered_set<size_t>>(_name, _settings, _testIndex++);
+
+		TestMap<Storage> shrinkingMap;
+		shrinkingMap.setMinLoadFactor(0.1f);
+		runDifferential<TestMap<Storage>, std::unordered_map<size_t, std::string>>(_name, shrinkingMap, _settings, _testIndex++);
+	}
+
+	// Multi        ChainedStorage
+	template<typename Storage>
+	void runStorage(const char* _name, const TestSettings& _settings, size_t& _testIndex, std::true_type)
+	{
+		runStorage<Storage>(_name, _settings, _testIndex, std::false_type());
+
+		runDifferential<TestMultiMap<Storage>, std::unordered_multimap<size_t, std::string>>(_name, _settings, _testIndex++);
+		runDifferential<TestMultiSet<Storage>, std::unordered_multiset<size_t>>(_name, _settings, _testIndex++);
+
+		TestMap<Storage> incrementalMap;
+		incrementalMap.setIncrementalRehash(true);
+		runDifferential<TestMap<Storage>, std::unordered_map<size_t, std::string>>(_name, incrementalMap, _settings, _testIndex++);
+
+		TestMultiMap<Storage> parallelMultiMap;
+		parallelMultiMap.setParallelRehash(true);
+		parallelMultiMap.setParallelRehashThreshold(64);
+		parallelMultiMap.setRehashThreadCount(3);
+		runDifferential<TestMultiMap<Storage>, std::unordered_multimap<size_t, std::string>>(_name, parallelMultiMap, _settings, _testIndex++);
+	}
+
+	template<typename Storage, bool IsChained>
+	void runStorage(const char* _name, const TestSettings& _settings, size_t& _testIndex)
+	{
+		runStorage<Storage>(_name, _settings, _testIndex, std::integral_constant<bool, IsChained>());
+		runExceptionInjection<Storage>(_name, 200, std::integral_constant<bool, IsChained>());
+	}
+}
+
+int main(int _argc, char** _argv)
+{
+	TestSettings settings;
+	settings.opCount = parseSize(getArgument(_argc, _argv, "ops", "20K"));
+	settings.keyCount = std::max<size_t>(parseSize(getArgument(_argc, _argv, "keys", "2K")), 1);
+	settings.seed = parseSize(getArgument(_argc, _argv, "seed", "1"));
+
+	size_t testIndex = 0;
+
+	runStorage<BHT_NAMESPACE::ChainedStorage, true>("ChainedStorage", settings, testIndex);
+	runStorage<BHT_NAMESPACE::TagHashChainedStorage, true>("TagHashChainedStorage", settings, testIndex);
+	runStorage<BHT_NAMESPACE::NoHashChainedStorage, true>("NoHashChainedStorage", settings, testIndex);
+	runStorage<BHT_NAMESPACE::SinglyLinkedChainedStorage, true>("SinglyLinkedChainedStorage", settings, testIndex);
+	runStorage<BHT_NAMESPACE::BasicChainedStorage<BHT_NAMESPACE::ModuloIndex>, true>("ChainedStorage<ModuloIndex>", settings, testIndex);
+	runStorage<BHT_NAMESPACE::BasicChainedStorage<BHT_NAMESPACE::PrimeIndex>, true>("ChainedStorage<PrimeIndex>", settings, testIndex);
+	runStorage<BHT_NAMESPACE::BasicChainedStorage<BHT_NAMESPACE::FastRangeIndex>, true>("ChainedStorage<FastRangeIndex>", settings, testIndex);
+	runStorage<BHT_NAMESPACE::SwissStorage, false>("SwissStorage", settings, testIndex);
+	runStorage<BHT_NAMESPACE::OrderedStorage, false>("OrderedStorage", settings, testIndex);
+
+	std::printf("containers %zu, ops %zu, keys %zu, seed %zu: %s\n", testIndex, settings.opCount, settings.keyCount, settings.seed,
+		failureCount == 0 ? "OK" : "FAILED");
+
+	return failureCount == 0 ? 0 : 1;
+}
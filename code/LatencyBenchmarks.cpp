@@ -0,0 +1,290 @@
+//    :    HashTableBenchmarks.cpp,    ,  
+// (   --batch )    TSC,     
+// LatencyHistogram.  (p99.9, max)     (checkLoadFactor,
+// reCreate)   ,    .
+//
+// (  code): g++ -O2 -std=c++17 -DNDEBUG LatencyBenchmarks.cpp -o LatencyBenchmarks
+//
+// ( ,   ):
+//   --containers=HashMap,HashMap+incremental,SwissHashMap,OrderedHashMap,std::unordered_map
+//                                       HashMap+incremental - HashMap   (setIncrementalRehash)
+//   --size=1M                            ,  K  M
+//   --batch=1                               ,     batch
+//   --presize=no,yes                      reserve(size)  
+//   --maxLoadFactors=default             setMaxLoadFactor(max_load_factor  std), default -  
+//   --gainFactors=default                setGainFactor, default -  ( std  default)
+//   --operations=insert,find,erase
+//   --csv                                  CSV
+//
+//  -  uint64_t,        ,     
+// .   : p50, p99, p99.9  .     TSC( 10 ns),  --batch=1
+//     ,     --batch=16  ,    - --batch=1
+
+#include <cstdio>
+#include <string>
+#include <vector>
+#include <unordered_map>
+
+#include "HashMap.h"
+#include "BenchmarkUtils.h"
+
+using namespace BenchmarkUtils;
+
+namespace
+{
+	//Subjects----------------------------------------------------------------------------------------------------------------------------------
+
+	//    .  false,      
+	template<typename Container>
+	struct Subject
+	{
+		static bool configure(Container& _container, float _maxLoadFactor, float _gainFactor, bool _isIncremental)
+		{
+			if (_maxLoadFactor > 0.0f && !_container.setMaxLoadFactor(_maxLoadFactor))
+				return false;
+
+			if (_gainFactor > 0.0f && !_container.setGainFactor(_gainFactor))
+				return false;
+
+			return !_isIncremental;
+		}
+
+		static void insert(Container& _container, uint64_t _key)
+		{
+			_container.insert(_key, _key);
+		}
+
+		static bool contains(const Container& _container, uint64_t _key)
+		{
+			return _container.contains(_key);
+		}
+	};
+
+	template<>
+	struct Subject<HashMap<uint64_t, uint64_t>>
+	{
+		using Container = HashMap<uint64_t, uint64_t>;
+
+		static bool configure(Container& _container, float _maxLoadFactor, float _gainFactor, bool _isIncremental)
+		{
+			if (_maxLoadFactor > 0.0f && !_container.setMaxLoadFactor(_maxLoadFactor))
+				return false;
+
+			if (_gainFactor > 0.0f && !_container.setGainFactor(_gainFactor))
+				return false;
+
+			_container.setIncrementalRehash(_isIncremental);
+			return true;
+		}
+
+		static void insert(Container& _container, uint64_t _key)
+		{
+			_container.insert(_key, _key);
+		}
+
+		static bool contains(const Container& _container, uint64_t _key)
+		{
+			return _container.contains(_key);
+		}
+	};
+
+	template<>
+	struct Subject<std::unordered_map<uint64_t, uint64_t>>
+	{
+		using Container = std::unordered_map<uint64_t, uint64_t>;
+
+		static bool configure(Container& _container, float _maxLoadFactor, float _gainFactor, bool _isIncremental)
+		{
+			if (_maxLoadFactor > 0.0f)
+				_container.max_load_factor(_maxLoadFactor);
+
+			return _gainFactor <= 0.0f && !_isIncremental;
+		}
+
+		static void insert(Container& _container, uint64_t _key)
+		{
+			_container.emplace(_key, _key);
+		}
+
+		static bool contains(const Container& _container, uint64_t _key)
+		{
+			return _container.find(_key) != _container.end();
+		}
+	};
+
+	//Options-----------------------------------------------------------------------------------------------------------------------------------
+
+	struct Options
+	{
+		std::vector<std::string> containers;
+		std::vector<std::string> operations;
+		std::vector<std::string> presize;
+		std::vector<float> maxLoadFactors;   // 0 -    
+		std::vector<float> gainFactors;
+		size_t size = 1000000;
+		size_t batch = 1;
+		bool isCsv = false;
+	};
+
+	std::vector<float> parseFactors(const std::string& _list)
+	{
+		std::vector<float> res;
+
+		for (const std::string& value : splitList(_list))
+			res.push_back(value == "default" ? 0.0f : static_cast<float>(std::atof(value.c_str())));
+
+		return res;
+	}
+
+	Options parseOptions(int _argc, char** _argv)
+	{
+		Options options;
+
+		options.containers = splitList(getArgument(_argc, _argv, "containers",
+			"HashMap,HashMap+incremental,SwissHashMap,OrderedHashMap,std::unordered_map"));
+		options.operations = splitList(getArgument(_argc, _argv, "operations", "insert,find,erase"));
+		options.presize = splitList(getArgument(_argc, _argv, "presize", "no,yes"));
+		options.maxLoadFactors = parseFactors(getArgument(_argc, _argv, "maxLoadFactors", "default"));
+		options.gainFactors = parseFactors(getArgument(_argc, _argv, "gainFactors", "default"));
+		options.size = std::max<size_t>(parseSize(getArgument(_argc, _argv, "size", "1M")), 1);
+		options.batch = std::max<size_t>(parseSize(getArgument(_argc, _argv, "batch", "1")), 1);
+		options.isCsv = hasFlag(_argc, _argv, "csv");
+
+		return options;
+	}
+
+	//Measuring---------------------------------------------------------------------------------------------------------------------------------
+
+	std::string factorName(float _factor)
+	{
+		if (_factor <= 0.0f)
+			return "default";
+
+		char text[16];
+		std::snprintf(text, sizeof(text), "%g", _factor);
+		return text;
+	}
+
+	void printHeader(const Options& _options)
+	{
+		if (_options.isCsv)
+			std::printf("container,presize,max_load_factor,gain_factor,operation,count,p50_ns,p99_ns,p999_ns,max_ns\n");
+		else
+			std::printf("%-20s %-7s %-8s %-8s %-7s %10s %9s %9s %9s %12s\n",
+				"container", "presize", "maxLF", "gain", "op", "samples", "p50", "p99", "p99.9", "max");
+	}
+
+	void printRow(const Options& _options, const std::string& _container, bool _isPresized, float _maxLoadFactor, float _gainFactor,
+		const char* _operation, const LatencyHistogram& _histogram)
+	{
+		//   batch    ,    -  / batch
+		double nsPerTick = 1.0 / (ticksPerNanosecond() * _options.batch);
+
+		const char* format = _options.isCsv ? "%s,%s,%s,%s,%s,%llu,%.1f,%.1f,%.1f,%.1f\n" :
+			"%-20s %-7s %-8s %-8s %-7s %10llu %9.1f %9.1f %9.1f %12.1f\n";
+
+		std::printf(format, _container.c_str(), _isPresized ? "yes" : "no", factorName(_maxLoadFactor).c_str(),
+			factorName(_gainFactor).c_str(), _operation, static_cast<unsigned long long>(_histogram.getCount()),
+			_histogram.getPercentile(50.0) * nsPerTick, _histogram.getPercentile(99.0) * nsPerTick,
+			_histogram.getPercentile(99.9) * nsPerTick, _histogram.getMax() * nsPerTick);
+		std::fflush(stdout);
+	}
+
+	//  _operation(i)  i  [0, _count)   _batch       _histogram
+	template<typename Operation>
+	void measureBatches(size_t _count, size_t _batch, LatencyHistogram& _histogram, Operation _operation)
+	{
+		for (size_t first = 0; first + _batch <= _count; first += _batch)
+		{
+			uint64_t begin = readTimestamp();
+
+			for (size_t i = first; i < first + _batch; ++i)
+				_operation(i);
+
+			uint64_t end = readTimestamp();
+			_histogram.record(end - begin);
+		}
+	}
+
+	template<typename Container>
+	void measureContainer(const Options& _options, const std::string& _name, bool _isIncremental, const std::vector<uint64_t>& _keys,
+		const std::vector<uint64_t>& _shuffledKeys)
+	{
+		using Ops = Subject<Container>;
+
+		if (!listContains(_options.containers, _name))
+			return;
+
+		for (const std::string& presize : _options.presize)
+		{
+			bool isPresized = presize == "yes";
+
+			for (float maxLoadFactor : _options.maxLoadFactors)
+			{
+				for (float gainFactor : _options.gainFactors)
+				{
+					Container container;
+
+					if (!Ops::configure(container, maxLoadFactor, gainFactor, _isIncremental))
+					{
+						std::fprintf(stderr, "%s: unsupported maxLoadFactor %s / gainFactor %s, skipped\n", _name.c_str(),
+							factorName(maxLoadFactor).c_str(), factorName(gainFactor).c_str());
+						continue;
+					}
+
+					if (isPresized)
+						container.reserve(_keys.size());
+
+					LatencyHistogram insertHistogram, findHistogram, eraseHistogram;
+					size_t resCount = 0;
+
+					measureBatches(_keys.size(), _options.batch, insertHistogram, [&](size_t _i)
+						{
+							Ops::insert(container, _keys[_i]);
+						});
+
+					measureBatches(_shuffledKeys.size(), _options.batch, findHistogram, [&](size_t _i)
+						{
+							resCount += Ops::contains(container, _shuffledKeys[_i]);
+						});
+
+					measureBatches(_shuffledKeys.size(), _options.batch, eraseHistogram, [&](size_t _i)
+						{
+							resCount += container.erase(_shuffledKeys[_i]);
+						});
+
+					doNotOptimize(resCount);
+
+					if (listContains(_options.operations, "insert"))
+						printRow(_options, _name, isPresized, maxLoadFactor, gainFactor, "insert", insertHistogram);
+
+					if (listContains(_options.operations, "find"))
+						printRow(_options, _name, isPresized, maxLoadFactor, gainFactor, "find", findHistogram);
+
+					if (listContains(_options.operations, "erase"))
+						printRow(_options, _name, isPresized, maxLoadFactor, gainFactor, "erase", eraseHistogram);
+				}
+			}
+		}
+	}
+}
+
+int main(int _argc, char** _argv)
+{
+	Options options = parseOptions(_argc, _argv);
+
+	std::vector<uint64_t> keys = makeInsertIds(options.size, Distribution::Uniform);
+	std::vector<uint64_t> shuffledKeys = keys;
+	std::shuffle(shuffledKeys.begin(), shuffledKeys.end(), std::mt19937_64(options.size));
+
+	ticksPerNanosecond(); //   
+	printHeader(options);
+
+	measureContainer<HashMap<uint64_t, uint64_t>>(options, "HashMap", false, keys, shuffledKeys);
+	measureContainer<HashMap<uint64_t, uint64_t>>(options, "HashMap+incremental", true, keys, shuffledKeys);
+	measureContainer<SwissHashMap<uint64_t, uint64_t>>(options, "SwissHashMap", false, keys, shuffledKeys);
+	measureContainer<OrderedHashMap<uint64_t, uint64_t>>(options, "OrderedHashMap", false, keys, shuffledKeys);
+	measureContainer<std::unordered_map<uint64_t, uint64_t>>(options, "std::unordered_map", false, keys, shuffledKeys);
+
+	return 0;
+}
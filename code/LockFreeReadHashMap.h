@@ -0,0 +1,424 @@
+#ifndef _LOCK_FREE_READ_HASH_MAP_H_
+#define _LOCK_FREE_READ_HASH_MAP_H_
+
+#include <atomic>
+#include <mutex>
+#include <utility>
+#include <functional>
+
+#include "HashTableBasic.h"
+#include "EpochReclamation.h"
+
+namespace BHM_NAMESPACE
+{
+	struct LockFreeReadHashMapDefaultProperties
+	{
+		static size_t deafaultBucketCount()
+		{
+			return 64;
+		}
+
+		static float defaultMaxLoadFactor()
+		{
+			return 0.7f;
+		}
+
+		static float defaultGainFactor()
+		{
+			return 2.0f;
+		}
+	};
+}
+
+
+// Map     : find, contains  visit       
+// read-modify-write .    mutex.      
+//   (EpochReclamation.h),        
+template<typename KeyType, typename ValueType, typename Hasher = std::hash<KeyType>, typename EqualComp = std::equal_to<KeyType>>
+class LockFreeReadHashMap
+{
+	using DefProps = BHM_NAMESPACE::LockFreeReadHashMapDefaultProperties;
+
+//Public Types----------------------------------------------------------------------------------------------------------------------------------
+public:
+
+	using PairType = std::pair<KeyType, ValueType>;
+	using HasherType = Hasher;
+	using EqualCompType = EqualComp;
+
+//Included Structs------------------------------------------------------------------------------------------------------------------------------
+private:
+
+	//        , insertOrAssign   
+	struct Node
+	{
+		const size_t hash;
+		const PairType pair;
+		std::atomic<Node*> next{ nullptr };
+
+		template<typename KT, typename VT>
+		Node(size_t _hash, KT&& _key, VT&& _value) :
+			hash(_hash), pair(std::forward<KT>(_key), std::forward<VT>(_value)) {};
+
+		Node(const Node& _other) :
+			hash(_other.hash), pair(_other.pair) {};
+	};
+
+	//    ,       ,   
+	//     ,    
+	struct BucketArray
+	{
+		size_t bucketCount;
+		BHT_NAMESPACE::PowerOfTwoIndex bucketIndex;
+		std::atomic<Node*>* heads;
+
+		explicit BucketArray(size_t _bucketCount) :
+			bucketCount(BHT_NAMESPACE::PowerOfTwoIndex::roundBucketCount(_bucketCount)),
+			heads(new std::atomic<Node*>[bucketCount])
+		{
+			bucketIndex.setBucketCount(bucketCount);
+
+			for (size_t i = 0; i < bucketCount; ++i)
+				heads[i].store(nullptr, std::memory_order_relaxed);
+		}
+
+		BucketArray(const BucketArray&) = delete;
+		BucketArray& operator=(const BucketArray&) = delete;
+
+		~BucketArray()
+		{
+			for (size_t i = 0; i < bucketCount; ++i)
+			{
+				Node* current = heads[i].load(std::memory_order_relaxed);
+				while (current)
+				{
+					Node* next = current->next.load(std::memory_order_relaxed);
+					delete current;
+					current = next;
+				}
+			}
+
+			delete[] heads;
+		}
+
+		std::atomic<Node*>& headFor(size_t _hash) const noexcept
+		{
+			return heads[bucketIndex.index(_hash)];
+		}
+	};
+
+//Properties(fields)----------------------------------------------------------------------------------------------------------------------------
+
+	std::atomic<BucketArray*> bucketArray;
+	std::atomic<size_t> elementCount{ 0 };
+
+	float maxLoadFactor = DefProps::defaultMaxLoadFactor();
+	float gainFactor = DefProps::defaultGainFactor();
+
+	Hasher hasher;
+	EqualComp comp;
+
+	std::mutex writerMutex;
+	BHT_NAMESPACE::EpochRetireList retireList; //    writerMutex
+
+//Private Methods-------------------------------------------------------------------------------------------------------------------------------
+
+	Node* innerFind(const BucketArray* _array, const KeyType& _key, size_t _hash) const noexcept
+	{
+		Node* current = _array->headFor(_hash).load(std::memory_order_acquire);
+
+		while (current)
+		{
+			if (current->hash == _hash && comp(_key, current->pair.first))
+				return current;
+
+			current = current->next.load(std::memory_order_acquire);
+		}
+
+		return nullptr;
+	}
+
+	//  ,      _key(   next  ),  nullptr.
+	//   
+	std::atomic<Node*>* findLink(BucketArray* _array, const KeyType& _key, size_t _hash) const noexcept
+	{
+		std::atomic<Node*>* link = &_array->headFor(_hash);
+
+		for (Node* current = link->load(std::memory_order_relaxed); current; current = link->load(std::memory_order_relaxed))
+		{
+			if (current->hash == _hash && comp(_key, current->pair.first))
+				return link;
+
+			link = &current->next;
+		}
+
+		return nullptr;
+	}
+
+	void placeNewNode(BucketArray* _array, Node* _newNode) noexcept
+	{
+		std::atomic<Node*>& head = _array->headFor(_newNode->hash);
+
+		//     , release store     
+		_newNode->next.store(head.load(std::memory_order_relaxed), std::memory_order_relaxed);
+		head.store(_newNode, std::memory_order_release);
+	}
+
+	void checkLoadFactor(BucketArray* _array)
+	{
+		size_t count = elementCount.load(std::memory_order_relaxed);
+
+		if (count > _array->bucketCount * maxLoadFactor)
+			reCreate(_array, static_cast<size_t>(_array->bucketCount * gainFactor));
+	}
+
+	//      ,    retireList    .  
+	//  :    map          64 
+	void retireBucketArray(BucketArray* _array)
+	{
+		retireList.retire(_array);
+		retireList.reclaim();
+	}
+
+	void reCreate(BucketArray* _array, size_t _newBucketCount)
+	{
+		BucketArray* newArray = new BucketArray(_newBucketCount);
+
+		//      ,     
+		for (size_t i = 0; i < _array->bucketCount; ++i)
+		{
+			for (Node* current = _array->heads[i].load(std::memory_order_relaxed); current; current = current->next.load(std::memory_order_relaxed))
+				placeNewNode(newArray, new Node(*current));
+		}
+
+		bucketArray.store(newArray, std::memory_order_release);
+		retireBucketArray(_array);
+	}
+
+	template<typename KT, typename VT>
+	bool innerInsert(KT&& _key, VT&& _value)
+	{
+		size_t hash = hasher(_key);
+		std::lock_guard<std::mutex> lock(writerMutex);
+
+		BucketArray* array = bucketArray.load(std::memory_order_relaxed);
+
+		//       ,   
+		if (findLink(array, _key, hash))
+			return false;
+
+		placeNewNode(array, new Node(hash, std::forward<KT>(_key), std::forward<VT>(_value)));
+		elementCount.store(elementCount.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+
+		checkLoadFactor(array);
+		return true;
+	}
+
+	template<typename KT, typename VT>
+	bool innerInsertOrAssign(KT&& _key, VT&& _value)
+	{
+		size_t hash = hasher(_key);
+		std::lock_guard<std::mutex> lock(writerMutex);
+
+		BucketArray* array = bucketArray.load(std::memory_order_relaxed);
+		std::atomic<Node*>* link = findLink(array, _key, hash);
+
+		if (!link)
+		{
+			placeNewNode(array, new Node(hash, std::forward<KT>(_key), std::forward<VT>(_value)));
+			elementCount.store(elementCount.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+
+			checkLoadFactor(array);
+			return true;
+		}
+
+		//     ,    ,    
+		Node* oldNode = link->load(std::memory_order_relaxed);
+		Node* newNode = new Node(hash, std::forward<KT>(_key), std::forward<VT>(_value));
+
+		newNode->next.store(oldNode->next.load(std::memory_order_relaxed), std::memory_order_relaxed);
+		link->store(newNode, std::memory_order_release);
+
+		retireList.retire(oldNode);
+		return false;
+	}
+
+//Public Methods--------------------------------------------------------------------------------------------------------------------------------
+public:
+
+	//Constructors & Destructor-----------------------------------------------------------------------------------------------------------------
+
+	LockFreeReadHashMap() : LockFreeReadHashMap(DefProps::deafaultBucketCount()) {};
+
+	explicit LockFreeReadHashMap(size_t _bucketCount) : bucketArray(new BucketArray(_bucketCount))
+	{
+		if (BHT_NAMESPACE::isValidHasher<KeyType, Hasher> && BHT_NAMESPACE::isValidComparator<KeyType, EqualComp>) {};
+	}
+
+	LockFreeReadHashMap(const LockFreeReadHashMap&) = delete;
+	LockFreeReadHashMap& operator=(const LockFreeReadHashMap&) = delete;
+
+	//       ,    retireList
+	~LockFreeReadHashMap()
+	{
+		delete bucketArray.load(std::memory_order_relaxed);
+	}
+
+	//Getting Properties------------------------------------------------------------------------------------------------------------------------
+
+	size_t size() const noexcept
+	{
+		return elementCount.load(std::memory_order_relaxed);
+	}
+
+	bool isEmpty() const noexcept
+	{
+		return size() == 0;
+	}
+
+	size_t getBucketCount() const noexcept
+	{
+		return bucketArray.load(std::memory_order_acquire)->bucketCount;
+	}
+
+	float getMaxLoadFactor() const noexcept
+	{
+		return maxLoadFactor;
+	}
+
+	//Setting Properties------------------------------------------------------------------------------------------------------------------------
+
+	void reserve(size_t _requiredElementCount)
+	{
+		std::lock_guard<std::mutex> lock(writerMutex);
+
+		BucketArray* array = bucketArray.load(std::memory_order_relaxed);
+
+		//       _requiredElementCount,   
+		if ((_requiredElementCount / maxLoadFactor) <= array->bucketCount)
+			return;
+
+		reCreate(array, static_cast<size_t>(_requiredElementCount / maxLoadFactor) + 1);
+	}
+
+	//Search------------------------------------------------------------------------------------------------------------------------------------
+
+	//      _key  _result.  false,   
+	bool find(const KeyType& _key, ValueType& _result) const
+	{
+		size_t hash = hasher(_key);
+		BHT_NAMESPACE::EpochGuard guard;
+
+		Node* res = innerFind(bucketArray.load(std::memory_order_acquire), _key, hash);
+		if (!res)
+			return false;
+
+		_result = res->pair.second;
+		return true;
+	}
+
+	bool contains(const KeyType& _key) const
+	{
+		size_t hash = hasher(_key);
+		BHT_NAMESPACE::EpochGuard guard;
+
+		return innerFind(bucketArray.load(std::memory_order_acquire), _key, hash) != nullptr;
+	}
+
+	//  _func(const KeyType&, const ValueType&)     _key  .
+	//     _func.  false,   
+	template<typename Func>
+	bool visit(const KeyType& _key, Func _func) const
+	{
+		size_t hash = hasher(_key);
+		BHT_NAMESPACE::EpochGuard guard;
+
+		Node* res = innerFind(bucketArray.load(std::memory_order_acquire), _key, hash);
+		if (!res)
+			return false;
+
+		_func(res->pair.first, res->pair.second);
+		return true;
+	}
+
+	//Insertion---------------------------------------------------------------------------------------------------------------------------------
+
+	//  ,      .  true,   
+	bool insert(const KeyType& _key, const ValueType& _value)
+	{
+		return innerInsert(_key, _value);
+	}
+
+	bool insert(KeyType&& _key, const ValueType& _value)
+	{
+		return innerInsert(std::move(_key), _value);
+	}
+
+	bool insert(const KeyType& _key, ValueType&& _value)
+	{
+		return innerInsert(_key, std::move(_value));
+	}
+
+	bool insert(KeyType&& _key, ValueType&& _value)
+	{
+		return innerInsert(std::move(_key), std::move(_value));
+	}
+
+	//      .  true,   
+	bool insertOrAssign(const KeyType& _key, const ValueType& _value)
+	{
+		return innerInsertOrAssign(_key, _value);
+	}
+
+	bool insertOrAssign(KeyType&& _key, const ValueType& _value)
+	{
+		return innerInsertOrAssign(std::move(_key), _value);
+	}
+
+	bool insertOrAssign(const KeyType& _key, ValueType&& _value)
+	{
+		return innerInsertOrAssign(_key, std::move(_value));
+	}
+
+	bool insertOrAssign(KeyType&& _key, ValueType&& _value)
+	{
+		return innerInsertOrAssign(std::move(_key), std::move(_value));
+	}
+
+	//Erasing-----------------------------------------------------------------------------------------------------------------------------------
+
+	size_t erase(const KeyType& _key)
+	{
+		size_t hash = hasher(_key);
+		std::lock_guard<std::mutex> lock(writerMutex);
+
+		std::atomic<Node*>* link = findLink(bucketArray.load(std::memory_order_relaxed), _key, hash);
+		if (!link)
+			return 0;
+
+		//  ,   next  ,  ,   ,  
+		Node* node = link->load(std::memory_order_relaxed);
+		link->store(node->next.load(std::memory_order_relaxed), std::memory_order_release);
+
+		elementCount.store(elementCount.load(std::memory_order_relaxed) - 1, std::memory_order_relaxed);
+
+		retireList.retire(node);
+		return 1;
+	}
+
+	//Modifying---------------------------------------------------------------------------------------------------------------------------------
+
+	void clear()
+	{
+		std::lock_guard<std::mutex> lock(writerMutex);
+
+		BucketArray* array = bucketArray.load(std::memory_order_relaxed);
+
+		bucketArray.store(new BucketArray(array->bucketCount), std::memory_order_release);
+		elementCount.store(0, std::memory_order_relaxed);
+
+		retireBucketArray(array);
+	}
+};
+
+#endif // !_LOCK_FREE_READ_HASH_MAP_H_
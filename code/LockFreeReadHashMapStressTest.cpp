@@ -0,0 +1,138 @@
+//  - LockFreeReadHashMap:      ,   
+//    (   )       insertOrAssign.
+//       ,   ,     .
+//        ThreadSanitizer  AddressSanitizer(  ).
+//
+// (  code): g++ -O1 -g -std=c++17 -fsanitize=thread -pthread LockFreeReadHashMapStressTest.cpp -o LockFreeReadHashMapStressTest
+//
+// ( ):
+//   --readers=3                           
+//   --writers=2                           
+//   --keys=1K                             ,  K  M
+//   --rounds=20                            
+//
+//   0,    ,  1      stderr
+
+#include <cstdio>
+#include <cstdlib>
+#include <algorithm>
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+#include <functional>
+
+#include "LockFreeReadHashMap.h"
+#include "BenchmarkUtils.h"
+
+using namespace BenchmarkUtils;
+
+namespace
+{
+	std::atomic<size_t> failureCount{ 0 };
+
+	// assert  :     NDEBUG
+	void check(bool _condition, const char* _description)
+	{
+		if (!_condition && failureCount.fetch_add(1, std::memory_order_relaxed) < 10)
+			std::fprintf(stderr, "check failed: %s\n", _description);
+	}
+
+	using MapType = LockFreeReadHashMap<size_t, std::string>;
+
+	//   _key      
+	std::string stableValue(size_t _key, bool _isAlternative)
+	{
+		return (_isAlternative ? "alt-" : "value-") + std::to_string(_key);
+	}
+
+	bool isStableValue(size_t _key, const std::string& _value)
+	{
+		return _value == stableValue(_key, false) || _value == stableValue(_key, true);
+	}
+
+	void runReader(const MapType& _map, size_t _stableKeyCount, const std::atomic<bool>& _stop)
+	{
+		std::string value;
+
+		while (!_stop.load(std::memory_order_relaxed))
+		{
+			for (size_t key = 0; key < _stableKeyCount; ++key)
+			{
+				check(_map.find(key, value) && isStableValue(key, value), "find sees a stable key with a valid value");
+				check(_map.visit(key, [key](const size_t& _key, const std::string& _value)
+					{
+						check(_key == key && isStableValue(key, _value), "visit sees a valid pair");
+					}), "visit finds a stable key");
+			}
+		}
+	}
+
+	//    _writer: [_firstTransientKey, _firstTransientKey + _transientKeyCount)
+	void runWriter(MapType& _map, size_t _writer, size_t _writerCount, size_t _stableKeyCount, size_t _firstTransientKey,
+		size_t _transientKeyCount, size_t _roundCount)
+	{
+		for (size_t round = 0; round < _roundCount; ++round)
+		{
+			for (size_t key = _firstTransientKey; key < _firstTransientKey + _transientKeyCount; ++key)
+				check(_map.insert(key, std::to_string(key)), "insert of a new transient key returns true");
+
+			//        
+			for (size_t key = _writer; key < _stableKeyCount; key += _writerCount)
+				check(!_map.insertOrAssign(key, stableValue(key, round % 2 == 0)), "insertOrAssign of a stable key assigns");
+
+			for (size_t key = _firstTransientKey; key < _firstTransientKey + _transientKeyCount; ++key)
+				check(_map.erase(key) == 1, "erase removes a transient key");
+		}
+	}
+}
+
+int main(int _argc, char** _argv)
+{
+	size_t readerCount = std::max<size_t>(parseSize(getArgument(_argc, _argv, "readers", "3")), 1);
+	size_t writerCount = std::max<size_t>(parseSize(getArgument(_argc, _argv, "writers", "2")), 1);
+	size_t stableKeyCount = std::max<size_t>(parseSize(getArgument(_argc, _argv, "keys", "1K")), 1);
+	size_t roundCount = std::max<size_t>(parseSize(getArgument(_argc, _argv, "rounds", "20")), 1);
+
+	//      8   ,       
+	//  ,    
+	size_t transientKeyCount = stableKeyCount * 8;
+
+	MapType map;
+
+	for (size_t key = 0; key < stableKeyCount; ++key)
+		map.insert(key, stableValue(key, false));
+
+	std::atomic<bool> stop{ false };
+	std::vector<std::thread> readers;
+	std::vector<std::thread> writers;
+
+	for (size_t r = 0; r < readerCount; ++r)
+		readers.emplace_back(runReader, std::cref(map), stableKeyCount, std::cref(stop));
+
+	for (size_t w = 0; w < writerCount; ++w)
+	{
+		writers.emplace_back(runWriter, std::ref(map), w, writerCount, stableKeyCount, stableKeyCount + w * transientKeyCount,
+			transientKeyCount, roundCount);
+	}
+
+	for (std::thread& writer : writers)
+		writer.join();
+
+	stop.store(true, std::memory_order_relaxed);
+
+	for (std::thread& reader : readers)
+		reader.join();
+
+	check(map.size() == stableKeyCount, "only stable keys remain");
+
+	map.clear();
+	check(map.isEmpty() && !map.contains(0), "clear empties the map");
+
+	size_t failures = failureCount.load();
+
+	std::printf("readers %zu, writers %zu, keys %zu, rounds %zu: %s\n", readerCount, writerCount, stableKeyCount, roundCount,
+		failures == 0 ? "OK" : "FAILED");
+
+	return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,379 @@
+#ifndef _MAPPED_HASH_MAP_H_
+#define _MAPPED_HASH_MAP_H_
+
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <functional>
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+#include "HashSnapshot.h"
+
+namespace BHM_NAMESPACE
+{
+	//       .      
+	//  ,    
+	class MappedFile
+	{
+		const char* data = nullptr;
+		uint64_t size = 0;
+
+#if defined(_WIN32)
+		HANDLE file = INVALID_HANDLE_VALUE;
+		HANDLE mapping = nullptr;
+#endif
+
+	public:
+
+		MappedFile() = default;
+
+		MappedFile(const MappedFile&) = delete;
+		MappedFile& operator=(const MappedFile&) = delete;
+
+		MappedFile(MappedFile&& _other) noexcept
+		{
+			swap(_other);
+		}
+
+		MappedFile& operator=(MappedFile&& _other) noexcept
+		{
+			if (this != &_other)
+			{
+				close();
+				swap(_other);
+			}
+
+			return *this;
+		}
+
+		~MappedFile()
+		{
+			close();
+		}
+
+		//   _path ,   .  false,    
+		//   (   )
+		bool open(const std::string& _path) noexcept
+		{
+			close();
+
+#if defined(_WIN32)
+			file = CreateFileA(_path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+			if (file == INVALID_HANDLE_VALUE)
+				return false;
+
+			LARGE_INTEGER fileSize;
+			if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart == 0)
+			{
+				close();
+				return false;
+			}
+
+			mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+			if (!mapping)
+			{
+				close();
+				return false;
+			}
+
+			data = static_cast<const char*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+			if (!data)
+			{
+				close();
+				return false;
+			}
+
+			size = static_cast<uint64_t>(fileSize.QuadPart);
+#else
+			int fd = ::open(_path.c_str(), O_RDONLY);
+			if (fd < 0)
+				return false;
+
+			struct stat fileStat;
+			if (::fstat(fd, &fileStat) != 0 || fileStat.st_size <= 0)
+			{
+				::close(fd);
+				return false;
+			}
+
+			void* address = ::mmap(nullptr, static_cast<size_t>(fileStat.st_size), PROT_READ, MAP_SHARED, fd, 0);
+			::close(fd); //      
+
+			if (address == MAP_FAILED)
+				return false;
+
+			data = static_cast<const char*>(address);
+			size = static_cast<uint64_t>(fileStat.st_size);
+#endif
+
+			return true;
+		}
+
+		void close() noexcept
+		{
+#if defined(_WIN32)
+			if (data)
+				UnmapViewOfFile(data);
+
+			if (mapping)
+				CloseHandle(mapping);
+
+			if (file != INVALID_HANDLE_VALUE)
+				CloseHandle(file);
+
+			mapping = nullptr;
+			file = INVALID_HANDLE_VALUE;
+#else
+			if (data)
+				::munmap(const_cast<char*>(data), static_cast<size_t>(size));
+#endif
+
+			data = nullptr;
+			size = 0;
+		}
+
+		void swap(MappedFile& _other) noexcept
+		{
+			std::swap(data, _other.data);
+			std::swap(size, _other.size);
+
+#if defined(_WIN32)
+			std::swap(file, _other.file);
+			std::swap(mapping, _other.mapping);
+#endif
+		}
+
+		const char* getData() const noexcept
+		{
+			return data;
+		}
+
+		uint64_t getSize() const noexcept
+		{
+			return size;
+		}
+	};
+}
+
+
+// Map     ,  HashMap::saveSnapshot.    , find, contains
+//        ,      ,
+//  ,   ,       .
+// KeyType, ValueType  Hasher       
+template<typename KeyType, typename ValueType, typename Hasher = std::hash<KeyType>, typename EqualComp = std::equal_to<KeyType>>
+class MappedHashMap
+{
+	static_assert(BHM_NAMESPACE::isSnapshotCompatible<KeyType, ValueType>, "MappedHashMap requires trivially copyable KeyType and ValueType");
+
+//Public Types----------------------------------------------------------------------------------------------------------------------------------
+public:
+
+	using EntryType = BHM_NAMESPACE::SnapshotEntry<KeyType, ValueType>;
+	using HasherType = Hasher;
+	using EqualCompType = EqualComp;
+
+	//     ,   -   
+	using ConstIteratorType = const EntryType*;
+
+//Properties(fields)----------------------------------------------------------------------------------------------------------------------------
+private:
+
+	BHM_NAMESPACE::MappedFile file;
+
+	const uint64_t* bucketTable = nullptr;
+	const EntryType* entries = nullptr;
+	size_t elementCount = 0;
+	size_t bucketCount = 0;
+	BHT_NAMESPACE::PowerOfTwoIndex bucketIndex;
+
+	Hasher hasher;
+	EqualComp comp;
+
+//Private Methods-------------------------------------------------------------------------------------------------------------------------------
+
+	void reset() noexcept
+	{
+		file.close();
+
+		bucketTable = nullptr;
+		entries = nullptr;
+		elementCount = bucketCount = 0;
+	}
+
+	bool isValidBucketTable(uint64_t _elementCount) const noexcept
+	{
+		if (bucketTable[0] != 0)
+			return false;
+
+		for (size_t i = 1; i <= bucketCount; ++i)
+		{
+			if (bucketTable[i] < bucketTable[i - 1] || bucketTable[i] > _elementCount)
+				return false;
+		}
+
+		return bucketTable[bucketCount] == _elementCount;
+	}
+
+//Public Methods--------------------------------------------------------------------------------------------------------------------------------
+public:
+
+	//Constructors & Destructor-----------------------------------------------------------------------------------------------------------------
+
+	MappedHashMap() = default;
+
+	//   _path,     (isOpen() == false)
+	explicit MappedHashMap(const std::string& _path)
+	{
+		open(_path);
+	}
+
+	MappedHashMap(const MappedHashMap&) = delete;
+	MappedHashMap& operator=(const MappedHashMap&) = delete;
+
+	MappedHashMap(MappedHashMap&& _other) noexcept
+	{
+		swap(_other);
+	}
+
+	MappedHashMap& operator=(MappedHashMap&& _other) noexcept
+	{
+		if (this != &_other)
+		{
+			reset();
+			swap(_other);
+		}
+
+		return *this;
+	}
+
+	//Opening-----------------------------------------------------------------------------------------------------------------------------------
+
+	//   _path,    .  false,     
+	//        KeyType  ValueType( ,     )
+	bool open(const std::string& _path)
+	{
+		reset();
+
+		if (!file.open(_path) || file.getSize() < sizeof(BHM_NAMESPACE::SnapshotHeader))
+		{
+			reset();
+			return false;
+		}
+
+		const BHM_NAMESPACE::SnapshotHeader* header = reinterpret_cast<const BHM_NAMESPACE::SnapshotHeader*>(file.getData());
+
+		if (!BHM_NAMESPACE::isValidSnapshotHeader<KeyType, ValueType>(*header, file.getSize()))
+		{
+			reset();
+			return false;
+		}
+
+		bucketTable = reinterpret_cast<const uint64_t*>(file.getData() + header->bucketTableOffset);
+		entries = reinterpret_cast<const EntryType*>(file.getData() + header->entryOffset);
+		elementCount = static_cast<size_t>(header->elementCount);
+		bucketCount = static_cast<size_t>(header->bucketCount);
+		bucketIndex.setBucketCount(bucketCount);
+
+		//      0,        ,    .
+		//          
+		if (!isValidBucketTable(header->elementCount))
+		{
+			reset();
+			return false;
+		}
+
+		return true;
+	}
+
+	void close() noexcept
+	{
+		reset();
+	}
+
+	bool isOpen() const noexcept
+	{
+		return entries != nullptr;
+	}
+
+	//Getting Properties------------------------------------------------------------------------------------------------------------------------
+
+	size_t size() const noexcept
+	{
+		return elementCount;
+	}
+
+	bool isEmpty() const noexcept
+	{
+		return elementCount == 0;
+	}
+
+	size_t getBucketCount() const noexcept
+	{
+		return bucketCount;
+	}
+
+	//Search------------------------------------------------------------------------------------------------------------------------------------
+
+	//       _key    end()
+	ConstIteratorType find(const KeyType& _key) const noexcept
+	{
+		if (!isOpen())
+			return end();
+
+		size_t bucket = bucketIndex.index(hasher(_key));
+
+		for (const EntryType* current = entries + bucketTable[bucket], *last = entries + bucketTable[bucket + 1]; current != last; ++current)
+		{
+			if (comp(_key, current->first))
+				return current;
+		}
+
+		return end();
+	}
+
+	bool contains(const KeyType& _key) const noexcept
+	{
+		return find(_key) != end();
+	}
+
+	//Iterator----------------------------------------------------------------------------------------------------------------------------------
+
+	//      
+	ConstIteratorType begin() const noexcept
+	{
+		return entries;
+	}
+
+	ConstIteratorType end() const noexcept
+	{
+		return entries + elementCount;
+	}
+
+	//Modifying---------------------------------------------------------------------------------------------------------------------------------
+
+	void swap(MappedHashMap& _other) noexcept
+	{
+		file.swap(_other.file);
+
+		std::swap(bucketTable, _other.bucketTable);
+		std::swap(entries, _other.entries);
+		std::swap(elementCount, _other.elementCount);
+		std::swap(bucketCount, _other.bucketCount);
+		std::swap(bucketIndex, _other.bucketIndex);
+		std::swap(hasher, _other.hasher);
+		std::swap(comp, _other.comp);
+	}
+};
+
+#endif // !_MAPPED_HASH_MAP_H_
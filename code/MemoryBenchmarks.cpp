@@ -0,0 +1,318 @@
+//  :           maxLoadFactor.
+//
+// (  code): g++ -O2 -std=c++17 -DNDEBUG MemoryBenchmarks.cpp -o MemoryBenchmarks
+//
+//   ,   maxLoadFactor    uint64_t ( map  - uint64_t)
+//  reserve,    :
+//   requested    ,   operator new   (  operator new,
+//                    ,     std::allocator)
+//   allocs        :     malloc( 8-16 ),    requested
+//   rss           resident set size ( Linux,      
+//                 malloc_trim,  ,   malloc,      )
+//   usage        getMemoryUsage().totalBytes(  ),   - bucketBytes,  payloadBytes
+//
+// ( ,   ):
+//   --containers=HashMap,HashSet,SwissHashMap,OrderedHashMap,std::unordered_map,std::unordered_set
+//   --sizes=1K,64K,1M                    ,  K  M
+//   --maxLoadFactors=default,0.5,1,2     setMaxLoadFactor(max_load_factor  std), default -  
+//   --csv                                  CSV
+
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <atomic>
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <unordered_set>
+
+#if defined(__linux__)
+#include <unistd.h>
+#endif
+
+#if defined(__GLIBC__)
+#include <malloc.h>
+#endif
+
+#include "HashMap.h"
+#include "HashSet.h"
+#include "BenchmarkUtils.h"
+
+using namespace BenchmarkUtils;
+
+//Counting Allocator--------------------------------------------------------------------------------------------------------------------------------
+
+//  operator new/delete      .   
+//    ,       
+namespace
+{
+	std::atomic<size_t> allocatedBytes{ 0 };
+	std::atomic<size_t> allocationCount{ 0 };
+
+	constexpr size_t allocationHeader = alignof(std::max_align_t);
+
+	void* countedAllocate(size_t _size)
+	{
+		void* block = std::malloc(_size + allocationHeader);
+
+		if (!block)
+			throw std::bad_alloc();
+
+		*static_cast<size_t*>(block) = _size;
+		allocatedBytes.fetch_add(_size, std::memory_order_relaxed);
+		allocationCount.fetch_add(1, std::memory_order_relaxed);
+
+		return static_cast<char*>(block) + allocationHeader;
+	}
+
+	void countedDeallocate(void* _pointer) noexcept
+	{
+		if (!_pointer)
+			return;
+
+		void* block = static_cast<char*>(_pointer) - allocationHeader;
+		allocatedBytes.fetch_sub(*static_cast<size_t*>(block), std::memory_order_relaxed);
+
+		std::free(block);
+	}
+}
+
+void* operator new(size_t _size)
+{
+	return countedAllocate(_size);
+}
+
+void* operator new[](size_t _size)
+{
+	return countedAllocate(_size);
+}
+
+void operator delete(void* _pointer) noexcept
+{
+	countedDeallocate(_pointer);
+}
+
+void operator delete[](void* _pointer) noexcept
+{
+	countedDeallocate(_pointer);
+}
+
+void operator delete(void* _pointer, size_t) noexcept
+{
+	countedDeallocate(_pointer);
+}
+
+void operator delete[](void* _pointer, size_t) noexcept
+{
+	countedDeallocate(_pointer);
+}
+
+namespace
+{
+	// Resident set size   , 0 -    
+	size_t residentBytes()
+	{
+#if defined(__linux__)
+		std::FILE* file = std::fopen("/proc/self/statm", "r");
+		if (!file)
+			return 0;
+
+		unsigned long long totalPages = 0, residentPages = 0;
+		int readCount = std::fscanf(file, "%llu %llu", &totalPages, &residentPages);
+		std::fclose(file);
+
+		return (readCount == 2) ? static_cast<size_t>(residentPages * sysconf(_SC_PAGESIZE)) : 0;
+#else
+		return 0;
+#endif
+	}
+
+	void releaseFreeMemory()
+	{
+#if defined(__GLIBC__)
+		malloc_trim(0);
+#endif
+	}
+
+	//Subjects----------------------------------------------------------------------------------------------------------------------------------
+
+	template<typename Container, bool _IsMap, bool _IsStd>
+	struct Subject;
+
+	template<typename Container, bool _IsMap>
+	struct Subject<Container, _IsMap, false>
+	{
+		static bool setMaxLoadFactor(Container& _container, float _maxLoadFactor)
+		{
+			return _container.setMaxLoadFactor(_maxLoadFactor);
+		}
+
+		static void insert(Container& _container, uint64_t _key)
+		{
+			insert(_container, _key, std::integral_constant<bool, _IsMap>());
+		}
+
+		static void insert(Container& _container, uint64_t _key, std::true_type)
+		{
+			_container.insert(_key, _key);
+		}
+
+		static void insert(Container& _container, uint64_t _key, std::false_type)
+		{
+			_container.insert(_key);
+		}
+
+		static bool getMemoryUsage(const Container& _container, BHT_NAMESPACE::HashTableMemoryUsage& _usage)
+		{
+			_usage = _container.getMemoryUsage();
+			return true;
+		}
+	};
+
+	template<typename Container, bool _IsMap>
+	struct Subject<Container, _IsMap, true>
+	{
+		static bool setMaxLoadFactor(Container& _container, float _maxLoadFactor)
+		{
+			_container.max_load_factor(_maxLoadFactor);
+			return true;
+		}
+
+		static void insert(Container& _container, uint64_t _key)
+		{
+			insert(_container, _key, std::integral_constant<bool, _IsMap>());
+		}
+
+		static void insert(Container& _container, uint64_t _key, std::true_type)
+		{
+			_container.emplace(_key, _key);
+		}
+
+		static void insert(Container& _container, uint64_t _key, std::false_type)
+		{
+			_container.insert(_key);
+		}
+
+		static bool getMemoryUsage(const Container&, BHT_NAMESPACE::HashTableMemoryUsage&)
+		{
+			return false;
+		}
+	};
+
+	//Options-----------------------------------------------------------------------------------------------------------------------------------
+
+	struct Options
+	{
+		std::vector<std::string> containers;
+		std::vector<size_t> sizes;
+		std::vector<float> maxLoadFactors;   // 0 -    
+		bool isCsv = false;
+	};
+
+	Options parseOptions(int _argc, char** _argv)
+	{
+		Options options;
+
+		options.containers = splitList(getArgument(_argc, _argv, "containers",
+			"HashMap,HashSet,SwissHashMap,OrderedHashMap,std::unordered_map,std::unordered_set"));
+
+		for (const std::string& size : splitList(getArgument(_argc, _argv, "sizes", "1K,64K,1M")))
+			options.sizes.push_back(std::max<size_t>(parseSize(size), 1));
+
+		for (const std::string& factor : splitList(getArgument(_argc, _argv, "maxLoadFactors", "default,0.5,1,2")))
+			options.maxLoadFactors.push_back(factor == "default" ? 0.0f : static_cast<float>(std::atof(factor.c_str())));
+
+		options.isCsv = hasFlag(_argc, _argv, "csv");
+
+		return options;
+	}
+
+	//Measuring---------------------------------------------------------------------------------------------------------------------------------
+
+	void printHeader(const Options& _options)
+	{
+		if (_options.isCsv)
+			std::printf("container,size,max_load_factor,requested_bpe,allocs_pe,rss_bpe,usage_bpe,bucket_bpe,payload_bpe\n");
+		else
+			std::printf("%-20s %10s %-8s %10s %8s %10s %10s %10s %10s\n",
+				"container", "size", "maxLF", "requested", "allocs", "rss", "usage", "(buckets)", "payload");
+	}
+
+	template<typename Container, bool _IsMap, bool _IsStd>
+	void measureContainer(const Options& _options, const std::string& _name)
+	{
+		using Ops = Subject<Container, _IsMap, _IsStd>;
+
+		if (!listContains(_options.containers, _name))
+			return;
+
+		for (size_t size : _options.sizes)
+		{
+			for (float maxLoadFactor : _options.maxLoadFactors)
+			{
+				releaseFreeMemory();
+
+				size_t bytesBefore = allocatedBytes.load(std::memory_order_relaxed);
+				size_t countBefore = allocationCount.load(std::memory_order_relaxed);
+				size_t residentBefore = residentBytes();
+
+				Container* container = new Container();
+
+				if (maxLoadFactor > 0.0f && !Ops::setMaxLoadFactor(*container, maxLoadFactor))
+				{
+					std::fprintf(stderr, "%s: unsupported maxLoadFactor %g, skipped\n", _name.c_str(), maxLoadFactor);
+					delete container;
+					continue;
+				}
+
+				for (size_t i = 0; i < size; ++i)
+					Ops::insert(*container, mixKeyId(i));
+
+				double requested = static_cast<double>(allocatedBytes.load(std::memory_order_relaxed) - bytesBefore);
+				double allocations = static_cast<double>(allocationCount.load(std::memory_order_relaxed) - countBefore);
+				double resident = static_cast<double>(residentBytes()) - static_cast<double>(residentBefore);
+
+				BHT_NAMESPACE::HashTableMemoryUsage usage;
+				bool hasUsage = Ops::getMemoryUsage(*container, usage);
+
+				delete container;
+
+				char factor[16] = "default";
+				if (maxLoadFactor > 0.0f)
+					std::snprintf(factor, sizeof(factor), "%g", maxLoadFactor);
+
+				const char* format = _options.isCsv ? "%s,%zu,%s,%.2f,%.4f,%.2f,%s,%s,%s\n" :
+					"%-20s %10zu %-8s %10.2f %8.4f %10.2f %10s %10s %10s\n";
+
+				char usageText[32] = "-", bucketText[32] = "-", payloadText[32] = "-";
+
+				if (hasUsage)
+				{
+					std::snprintf(usageText, sizeof(usageText), "%.2f", static_cast<double>(usage.totalBytes) / size);
+					std::snprintf(bucketText, sizeof(bucketText), "%.2f", static_cast<double>(usage.bucketBytes) / size);
+					std::snprintf(payloadText, sizeof(payloadText), "%.2f", static_cast<double>(usage.payloadBytes) / size);
+				}
+
+				std::printf(format, _name.c_str(), size, factor, requested / size, allocations / size, resident / size,
+					usageText, bucketText, payloadText);
+				std::fflush(stdout);
+			}
+		}
+	}
+}
+
+int main(int _argc, char** _argv)
+{
+	Options options = parseOptions(_argc, _argv);
+
+	printHeader(options);
+
+	measureContainer<HashMap<uint64_t, uint64_t>, true, false>(options, "HashMap");
+	measureContainer<HashSet<uint64_t>, false, false>(options, "HashSet");
+	measureContainer<SwissHashMap<uint64_t, uint64_t>, true, false>(options, "SwissHashMap");
+	measureContainer<OrderedHashMap<uint64_t, uint64_t>, true, false>(options, "OrderedHashMap");
+	measureContainer<std::unordered_map<uint64_t, uint64_t>, true, true>(options, "std::unordered_map");
+	measureContainer<std::unordered_set<uint64_t>, false, true>(options, "std::unordered_set");
+
+	return 0;
+}
@@ -0,0 +1,260 @@
+#ifndef _NODE_POOL_H_
+#define _NODE_POOL_H_
+
+#include <utility>
+#include <memory>
+#include <new>
+#include <type_traits>
+
+namespace BHT_NAMESPACE
+{
+	struct NodePoolDefaultProperties
+	{
+		static size_t firstBlockNodeCount()
+		{
+			return 16;
+		}
+
+		static size_t maxBlockNodeCount()
+		{
+			return 16384;
+		}
+	};
+
+
+	template<typename NodeType, typename Allocator = std::allocator<NodeType>>
+	class NodePool;
+}
+
+
+// Slab  :     ,      ,
+//      release().       Allocator(rebind   ),
+//    (std::pmr::monotonic_buffer_resource)       
+template<typename NodeType, typename Allocator>
+class BHT_NAMESPACE::NodePool
+{
+	using DefProps = NodePoolDefaultProperties;
+
+//Included Structs------------------------------------------------------------------------------------------------------------------------------
+
+	union Cell
+	{
+		Cell* nextFree;
+		typename std::aligned_storage<sizeof(NodeType), alignof(NodeType)>::type storage;
+	};
+
+	struct Block
+	{
+		Cell* cells;
+		size_t cellCount;
+		Block* next;
+	};
+
+	using CellAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Cell>;
+	using CellAllocatorTraits = std::allocator_traits<CellAllocator>;
+	using BlockAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Block>;
+	using BlockAllocatorTraits = std::allocator_traits<BlockAllocator>;
+
+//Properties(fields)----------------------------------------------------------------------------------------------------------------------------
+
+	Block* blockList = nullptr;
+	Cell* freeList = nullptr;
+
+	Cell* bumpPtr = nullptr;
+	Cell* bumpEnd = nullptr;
+
+	size_t nextBlockNodeCount = DefProps::firstBlockNodeCount();
+
+	Allocator allocator;
+
+//Private Methods-------------------------------------------------------------------------------------------------------------------------------
+
+	void addBlock(size_t _cellCount)
+	{
+		//     ,     
+		while (bumpPtr != bumpEnd)
+			putCell(bumpPtr++);
+
+		CellAllocator cellAllocator(allocator);
+		BlockAllocator blockAllocator(allocator);
+
+		Cell* cells = CellAllocatorTraits::allocate(cellAllocator, _cellCount);
+		Block* block = nullptr;
+
+		try
+		{
+			block = BlockAllocatorTraits::allocate(blockAllocator, 1);
+		}
+		catch (...)
+		{
+			CellAllocatorTraits::deallocate(cellAllocator, cells, _cellCount);
+			throw;
+		}
+
+		BlockAllocatorTraits::construct(blockAllocator, block, Block{ cells, _cellCount, blockList });
+
+		blockList = block;
+		bumpPtr = block->cells;
+		bumpEnd = block->cells + _cellCount;
+	}
+
+	Cell* takeCell()
+	{
+		if (freeList)
+		{
+			Cell* cell = freeList;
+			freeList = freeList->nextFree;
+			return cell;
+		}
+
+		if (bumpPtr == bumpEnd)
+		{
+			addBlock(nextBlockNodeCount);
+
+			//       maxBlockNodeCount
+			if (nextBlockNodeCount < DefProps::maxBlockNodeCount())
+				nextBlockNodeCount *= 2;
+		}
+
+		return bumpPtr++;
+	}
+
+	void putCell(Cell* _cell) noexcept
+	{
+		_cell->nextFree = freeList;
+		freeList = _cell;
+	}
+
+	void swapAllocators(NodePool& _other, std::true_type) noexcept
+	{
+		using std::swap;
+		swap(allocator, _other.allocator);
+	}
+
+	//   propagate_on_container_swap  ,    
+	void swapAllocators(NodePool&, std::false_type) noexcept {};
+
+//Public Methods--------------------------------------------------------------------------------------------------------------------------------
+public:
+
+	//Constructors & Destructor-----------------------------------------------------------------------------------------------------------------
+
+	NodePool() = default;
+
+	explicit NodePool(const Allocator& _allocator) : allocator(_allocator) {};
+
+	NodePool(const NodePool&) = delete;
+	NodePool& operator=(const NodePool&) = delete;
+
+	~NodePool()
+	{
+		release();
+	}
+
+	//Allocation--------------------------------------------------------------------------------------------------------------------------------
+
+	template<typename... Args>
+	NodeType* create(Args&&... _args)
+	{
+		Cell* cell = takeCell();
+
+		try
+		{
+			return new (&cell->storage) NodeType(std::forward<Args>(_args)...);
+		}
+		catch (...)
+		{
+			putCell(cell);
+			throw;
+		}
+	}
+
+	void destroy(NodeType* _node) noexcept
+	{
+		_node->~NodeType();
+		putCell(reinterpret_cast<Cell*>(_node));
+	}
+
+	//    _nodeCount   
+	void reserve(size_t _nodeCount)
+	{
+		size_t available = static_cast<size_t>(bumpEnd - bumpPtr);
+
+		if (_nodeCount > available)
+			addBlock(_nodeCount - available);
+	}
+
+	//Getting Properties------------------------------------------------------------------------------------------------------------------------
+
+	Allocator getAllocator() const noexcept
+	{
+		return allocator;
+	}
+
+	//    ,       
+	size_t getAllocatedBytes() const noexcept
+	{
+		size_t bytes = 0;
+
+		for (const Block* block = blockList; block; block = block->next)
+			bytes += block->cellCount * sizeof(Cell) + sizeof(Block);
+
+		return bytes;
+	}
+
+	//Modifying---------------------------------------------------------------------------------------------------------------------------------
+
+	//   .    ,     
+	void release() noexcept
+	{
+		CellAllocator cellAllocator(allocator);
+		BlockAllocator blockAllocator(allocator);
+
+		while (blockList)
+		{
+			Block* next = blockList->next;
+
+			CellAllocatorTraits::deallocate(cellAllocator, blockList->cells, blockList->cellCount);
+			BlockAllocatorTraits::destroy(blockAllocator, blockList);
+			BlockAllocatorTraits::deallocate(blockAllocator, blockList, 1);
+
+			blockList = next;
+		}
+
+		freeList = bumpPtr = bumpEnd = nullptr;
+		nextBlockNodeCount = DefProps::firstBlockNodeCount();
+	}
+
+	//    _other,    _other   .
+	//   _other  ,        release().
+	//     ,      
+	void adopt(NodePool& _other) noexcept
+	{
+		if (!_other.blockList)
+			return;
+
+		Block* lastBlock = _other.blockList;
+		while (lastBlock->next)
+			lastBlock = lastBlock->next;
+
+		lastBlock->next = blockList;
+		blockList = _other.blockList;
+
+		_other.blockList = nullptr;
+		_other.freeList = _other.bumpPtr = _other.bumpEnd = nullptr;
+		_other.nextBlockNodeCount = DefProps::firstBlockNodeCount();
+	}
+
+	void swap(NodePool& _other) noexcept
+	{
+		std::swap(blockList, _other.blockList);
+		std::swap(freeList, _other.freeList);
+		std::swap(bumpPtr, _other.bumpPtr);
+		std::swap(bumpEnd, _other.bumpEnd);
+		std::swap(nextBlockNodeCount, _other.nextBlockNodeCount);
+
+		swapAllocators(_other, typename std::allocator_traits<Allocator>::propagate_on_container_swap());
+	}
+};
+
+#endif // !_NODE_POOL_H_
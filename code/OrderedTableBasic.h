@@ -0,0 +1,1055 @@
+#ifndef _ORDERED_TABLE_BASIC_H_
+#define _ORDERED_TABLE_BASIC_H_
+
+#include <utility>
+#include <functional>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <iterator>
+
+#include "HashTableBasic.h"
+
+namespace BHT_NAMESPACE
+{
+	struct OrderedTableDefaultProperties
+	{
+		static size_t deafaultBucketCount()
+		{
+			return 16;
+		}
+
+		static float defaultMaxLoadFactor()
+		{
+			return 0.75f;
+		}
+
+		static float defaultGainFactor()
+		{
+			return 2.0f;
+		}
+
+		// 0 -    
+		static float defaultMinLoadFactor()
+		{
+			return 0.0f;
+		}
+
+		//   ,        
+		static float compactionFactor()
+		{
+			return 0.25f;
+		}
+
+		//  ,  findBatch/containsBatch   
+		static constexpr size_t findBatchWindow = 16;
+
+		// clear()    ,    ,    sparseClearRatio  
+		static constexpr size_t sparseClearRatio = 8;
+	};
+
+
+	template<bool Multi, typename NodeType, typename Hasher, typename EqualComp, typename Allocator = std::allocator<NodeType>>
+	class OrderedTable;
+
+	//    front-end':           
+	struct OrderedStorage
+	{
+		static constexpr bool isFlat = true;
+
+		template<bool Multi, typename NodeType, typename Hasher, typename EqualComp, typename Allocator = std::allocator<NodeType>>
+		using Table = OrderedTable<Multi, NodeType, Hasher, EqualComp, Allocator>;
+	};
+}
+
+
+template<bool Multi, typename NodeType, typename Hasher, typename EqualComp, typename Allocator>
+class BHT_NAMESPACE::OrderedTable
+{
+	static_assert(!Multi, "OrderedTable does not support multi containers");
+
+public:
+
+	using AllocatorType = Allocator;
+
+protected:
+
+	using DefProps = OrderedTableDefaultProperties;
+	using KeyType = typename NodeType::KeyType;
+	using EntryAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<NodeType>;
+	using EntryAllocatorTraits = std::allocator_traits<EntryAllocator>;
+	using IndexAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<size_t>;
+	using IndexAllocatorTraits = std::allocator_traits<IndexAllocator>;
+
+//Included Structs------------------------------------------------------------------------------------------------------------------------------
+
+	struct EntryInfo
+	{
+		size_t hash;
+		bool erased;
+	};
+
+	using InfoAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<EntryInfo>;
+	using InfoAllocatorTraits = std::allocator_traits<InfoAllocator>;
+
+//Properties(fields)----------------------------------------------------------------------------------------------------------------------------
+
+	static constexpr bool isMulti = Multi;
+	static constexpr size_t emptyBucket = ~size_t(0);
+
+	//      ,        .
+	// ( ,  )    .
+	//      ,    bucketCount  0,     
+	NodeType* entryArray = nullptr;
+	EntryInfo* infoArray = nullptr;
+	size_t* bucketArray = nullptr;
+
+	size_t bucketCount = 0;
+	size_t entryCapacity = 0;
+	size_t entryCount = 0; //   
+	size_t elementCount = 0;
+	size_t erasedCount = 0;
+
+	float loadFactor = 0.0f;
+	float maxLoadFactor = DefProps::defaultMaxLoadFactor();
+	float gainFactor = DefProps::defaultGainFactor();
+	float minLoadFactor = DefProps::defaultMinLoadFactor();
+
+	Hasher hasher;
+	EqualComp comp;
+
+	// ,         rebind  NodeType, EntryInfo  size_t
+	Allocator allocator;
+
+	NodeType* beforeBeginPtr = reinterpret_cast<NodeType*>(SentinelNodes<NodeType>::beforeBegin);
+	NodeType* endPtr = reinterpret_cast<NodeType*>(SentinelNodes<NodeType>::end);
+
+//Protected Methods-----------------------------------------------------------------------------------------------------------------------------
+
+	//Constructors & Destructor-----------------------------------------------------------------------------------------------------------------
+
+	//   ,     
+	OrderedTable() : OrderedTable(Allocator()) {};
+
+	explicit OrderedTable(const Allocator& _allocator) : allocator(_allocator)
+	{
+		if (isValidHasher<KeyType, Hasher> && isValidComparator<KeyType, EqualComp>) {};
+	}
+
+	OrderedTable(size_t _bucketCount, const Allocator& _allocator = Allocator()) : OrderedTable(_allocator)
+	{
+		allocateArrays(normalizeBucketCount(_bucketCount));
+	}
+
+	~OrderedTable()
+	{
+		destroyEntries();
+
+		freeArrays(entryArray, infoArray, bucketArray, entryCapacity, bucketCount);
+	}
+
+	//Specific Methods--------------------------------------------------------------------------------------------------------------------------
+
+	static size_t normalizeBucketCount(size_t _bucketCount) noexcept
+	{
+		//   -  ,   8
+		size_t result = 8;
+		while (result < _bucketCount)
+			result <<= 1;
+
+		return result;
+	}
+
+	size_t capacityFor(size_t _bucketCount) const noexcept
+	{
+		size_t capacity = static_cast<size_t>(_bucketCount * maxLoadFactor);
+
+		//       ,      
+		if (capacity >= _bucketCount)
+			capacity = _bucketCount - 1;
+
+		return (capacity == 0) ? 1 : capacity;
+	}
+
+	void allocateArrays(size_t _bucketCount)
+	{
+		bucketCount = _bucketCount;
+		entryCapacity = capacityFor(bucketCount);
+
+		IndexAllocator indexAllocator(allocator);
+		InfoAllocator infoAllocator(allocator);
+		EntryAllocator entryAllocator(allocator);
+
+		bucketArray = IndexAllocatorTraits::allocate(indexAllocator, bucketCount);
+		for (size_t i = 0; i < bucketCount; ++i)
+			bucketArray[i] = emptyBucket;
+
+		infoArray = InfoAllocatorTraits::allocate(infoAllocator, entryCapacity);
+		entryArray = EntryAllocatorTraits::allocate(entryAllocator, entryCapacity);
+	}
+
+	// EntryInfo   ,        
+	void freeArrays(NodeType* _entryArray, EntryInfo* _infoArray, size_t* _bucketArray, size_t _entryCapacity,
+		size_t _bucketCount) noexcept
+	{
+		if (!_bucketArray)
+			return;
+
+		IndexAllocator indexAllocator(allocator);
+		InfoAllocator infoAllocator(allocator);
+		EntryAllocator entryAllocator(allocator);
+
+		EntryAllocatorTraits::deallocate(entryAllocator, _entryArray, _entryCapacity);
+		InfoAllocatorTraits::deallocate(infoAllocator, _infoArray, _entryCapacity);
+		IndexAllocatorTraits::deallocate(indexAllocator, _bucketArray, _bucketCount);
+	}
+
+	void swapAllocators(OrderedTable& _other, std::true_type) noexcept
+	{
+		using std::swap;
+		swap(allocator, _other.allocator);
+	}
+
+	//   propagate_on_container_swap  ,    
+	void swapAllocators(OrderedTable&, std::false_type) noexcept {};
+
+	void destroyEntries() noexcept
+	{
+		if (std::is_trivially_destructible<NodeType>::value)
+			return;
+
+		for (size_t i = 0; i < entryCount; ++i)
+		{
+			if (!infoArray[i].erased)
+				entryArray[i].~NodeType();
+		}
+	}
+
+	void checkLoadFactor() noexcept
+	{
+		loadFactor = (bucketCount != 0) ? static_cast<float>(elementCount) / bucketCount : 0.0f;
+	}
+
+	//      ,   
+	void setEmptyArrays() noexcept
+	{
+		entryArray = nullptr;
+		infoArray = nullptr;
+		bucketArray = nullptr;
+		bucketCount = entryCapacity = 0;
+	}
+
+	//    -  ( )
+	size_t visitUnitCount() const noexcept
+	{
+		return entryCount;
+	}
+
+	//  _func(NodeType*)       [_first, _last)
+	template<typename Func>
+	void forEachNodeInUnits(size_t _first, size_t _last, Func _func) const
+	{
+		for (size_t i = _first; i < _last; ++i)
+		{
+			if (!infoArray[i].erased)
+				_func(entryArray + i);
+		}
+	}
+
+	size_t firstBucket(size_t _hash) const noexcept
+	{
+		return mixHash(_hash) & (bucketCount - 1);
+	}
+
+	void placeIndex(size_t _entryIndex) noexcept
+	{
+		size_t mask = bucketCount - 1;
+		size_t pos = firstBucket(infoArray[_entryIndex].hash);
+
+		while (bucketArray[pos] != emptyBucket)
+			pos = (pos + 1) & mask;
+
+		bucketArray[pos] = _entryIndex;
+	}
+
+	void rebuildBuckets() noexcept
+	{
+		for (size_t i = 0; i < bucketCount; ++i)
+			bucketArray[i] = emptyBucket;
+
+		for (size_t i = 0; i < entryCount; ++i)
+			placeIndex(i);
+	}
+
+	void compact() noexcept
+	{
+		//        
+		size_t target = 0;
+
+		for (size_t i = 0; i < entryCount; ++i)
+		{
+			if (infoArray[i].erased)
+				continue;
+
+			if (target != i)
+			{
+				new (entryArray + target) NodeType(std::move(entryArray[i]));
+				entryArray[i].~NodeType();
+				infoArray[target] = infoArray[i];
+			}
+
+			++target;
+		}
+
+		entryCount = target;
+		erasedCount = 0;
+
+		rebuildBuckets();
+	}
+
+	//    .      ,
+	//  loadFactor    ,   
+	void checkShrink() noexcept
+	{
+		if (minLoadFactor == 0.0f || bucketCount == 0 || static_cast<float>(elementCount) / bucketCount >= minLoadFactor)
+			return;
+
+		size_t newBucketCount = normalizeBucketCount(static_cast<size_t>(elementCount * gainFactor / maxLoadFactor) + 1);
+
+		if (newBucketCount < DefProps::deafaultBucketCount())
+			newBucketCount = normalizeBucketCount(DefProps::deafaultBucketCount());
+
+		if (newBucketCount < bucketCount)
+			reCreate(newBucketCount);
+	}
+
+	//    :        .   
+	// , .      
+	void clearEntryBuckets() noexcept
+	{
+		size_t mask = bucketCount - 1;
+
+		for (size_t i = 0; i < entryCount; ++i)
+		{
+			if (infoArray[i].erased)
+				continue;
+
+			size_t pos = firstBucket(infoArray[i].hash);
+
+			while (bucketArray[pos] != i)
+				pos = (pos + 1) & mask;
+
+			bucketArray[pos] = emptyBucket;
+		}
+	}
+
+	void reCreate(size_t _newBucketCount) noexcept
+	{
+		NodeType* oldEntryArray = entryArray;
+		EntryInfo* oldInfoArray = infoArray;
+		size_t* oldBucketArray = bucketArray;
+		size_t oldEntryCapacity = entryCapacity;
+		size_t oldEntryCount = entryCount;
+		size_t oldBucketCount = bucketCount;
+
+		allocateArrays(_newBucketCount);
+
+		//      ,    
+		entryCount = 0;
+
+		for (size_t i = 0; i < oldEntryCount; ++i)
+		{
+			if (oldInfoArray[i].erased)
+				continue;
+
+			new (entryArray + entryCount) NodeType(std::move(oldEntryArray[i]));
+			oldEntryArray[i].~NodeType();
+
+			infoArray[entryCount] = oldInfoArray[i];
+			placeIndex(entryCount);
+			++entryCount;
+		}
+
+		erasedCount = 0;
+		checkLoadFactor();
+
+		freeArrays(oldEntryArray, oldInfoArray, oldBucketArray, oldEntryCapacity, oldBucketCount);
+	}
+
+	void prepareInsert() noexcept
+	{
+		if (bucketCount == 0)
+		{
+			allocateArrays(normalizeBucketCount(DefProps::deafaultBucketCount()));
+			return;
+		}
+
+		if (entryCount < entryCapacity)
+			return;
+
+		//       ,   
+		if (erasedCount >= entryCount * DefProps::compactionFactor())
+		{
+			compact();
+			return;
+		}
+
+		size_t newBucketCount = static_cast<size_t>(bucketCount * gainFactor);
+		reCreate(normalizeBucketCount((newBucketCount > bucketCount) ? newBucketCount : bucketCount + 1));
+	}
+
+	//     entryArray[entryCount]
+	NodeType* commitEntry(size_t _hash) noexcept
+	{
+		infoArray[entryCount] = EntryInfo{ _hash, false };
+		placeIndex(entryCount);
+
+		++elementCount;
+		checkLoadFactor();
+
+		return entryArray + entryCount++;
+	}
+
+	template<typename... Args>
+	NodeType* placeNewEntry(size_t _hash, Args&&... _args)
+	{
+		prepareInsert();
+
+		//   ,         
+		new (entryArray + entryCount) NodeType(_hash, std::forward<Args>(_args)...);
+
+		return commitEntry(_hash);
+	}
+
+	//Construction------------------------------------------------------------------------------------------------------------------------------
+
+	void copyConstruct(const OrderedTable& _other)
+	{
+		freeArrays(entryArray, infoArray, bucketArray, entryCapacity, bucketCount);
+
+		//   _other
+		maxLoadFactor = _other.maxLoadFactor;
+		gainFactor = _other.gainFactor;
+		minLoadFactor = _other.minLoadFactor;
+
+		//  _other       
+		if (_other.bucketCount == 0)
+		{
+			setEmptyArrays();
+			return;
+		}
+
+		allocateArrays(_other.bucketCount);
+
+		//   
+		for (size_t i = 0; i < _other.entryCount; ++i)
+		{
+			if (_other.infoArray[i].erased)
+				continue;
+
+			new (entryArray + entryCount) NodeType(_other.entryArray + i);
+			infoArray[entryCount] = _other.infoArray[i];
+			placeIndex(entryCount);
+
+			++entryCount;
+			++elementCount;
+		}
+
+		checkLoadFactor();
+	}
+
+	//        _other:  _other   
+	void moveConstruct(OrderedTable& _other) noexcept
+	{
+		freeArrays(entryArray, infoArray, bucketArray, entryCapacity, bucketCount);
+
+		//   _other
+		entryArray = _other.entryArray;
+		infoArray = _other.infoArray;
+		bucketArray = _other.bucketArray;
+		bucketCount = _other.bucketCount;
+		entryCapacity = _other.entryCapacity;
+		entryCount = _other.entryCount;
+		elementCount = _other.elementCount;
+		erasedCount = _other.erasedCount;
+		loadFactor = _other.loadFactor;
+		maxLoadFactor = _other.maxLoadFactor;
+		gainFactor = _other.gainFactor;
+		minLoadFactor = _other.minLoadFactor;
+
+		//  _other  default .     , _other   ,
+		//     
+		_other.setEmptyArrays();
+		_other.maxLoadFactor = DefProps::defaultMaxLoadFactor();
+		_other.gainFactor = DefProps::defaultGainFactor();
+		_other.minLoadFactor = DefProps::defaultMinLoadFactor();
+		_other.entryCount = 0;
+		_other.elementCount = 0;
+		_other.erasedCount = 0;
+		_other.loadFactor = 0.0f;
+	}
+
+	//Search------------------------------------------------------------------------------------------------------------------------------------
+
+	//  ,     _key,  emptyBucket
+	template<typename K>
+	size_t findBucket(const K& _key, size_t _hash) const noexcept
+	{
+		if (bucketCount == 0)
+			return emptyBucket;
+
+		size_t mask = bucketCount - 1;
+		size_t pos = firstBucket(_hash);
+
+		while (bucketArray[pos] != emptyBucket)
+		{
+			size_t entryIndex = bucketArray[pos];
+
+			if (infoArray[entryIndex].hash == _hash && comp(_key, entryArray[entryIndex].getKey()))
+				return pos;
+
+			pos = (pos + 1) & mask;
+		}
+
+		return emptyBucket;
+	}
+
+	template<typename K>
+	NodeType* findEntry(const K& _key, size_t _hash) const noexcept
+	{
+		size_t pos = findBucket(_key, _hash);
+
+		if (pos == emptyBucket)
+			return endPtr;
+
+		return entryArray + bucketArray[pos];
+	}
+
+	NodeType* innerFind(const KeyType& _key, size_t _hash) const noexcept
+	{
+		return findEntry(_key, _hash);
+	}
+
+	//  :        KeyType
+	template<typename K, typename = EnableTransparentLookup<Hasher, EqualComp, K>>
+	NodeType* innerFind(const K& _key, size_t _hash) const noexcept
+	{
+		return findEntry(_key, _hash);
+	}
+
+	//    findBatchWindow :         ,
+	//            .
+	//       _output(NodeType*),    endPtr
+	template<typename Output>
+	void innerFindBatch(const KeyType* _keys, size_t _count, Output _output) const
+	{
+		const size_t window = DefProps::findBatchWindow;
+		size_t hashes[window];
+
+		if (bucketCount == 0)
+		{
+			for (size_t i = 0; i < _count; ++i)
+				_output(endPtr);
+
+			return;
+		}
+
+		for (size_t base = 0; base < _count; base += window)
+		{
+			size_t windowSize = (_count - base < window) ? _count - base : window;
+
+			for (size_t i = 0; i < windowSize; ++i)
+			{
+				hashes[i] = hasher(_keys[base + i]);
+				prefetchRead(bucketArray + firstBucket(hashes[i]));
+			}
+
+			for (size_t i = 0; i < windowSize; ++i)
+			{
+				size_t entryIndex = bucketArray[firstBucket(hashes[i])];
+
+				if (entryIndex != emptyBucket)
+				{
+					prefetchRead(infoArray + entryIndex);
+					prefetchRead(entryArray + entryIndex);
+				}
+			}
+
+			for (size_t i = 0; i < windowSize; ++i)
+				_output(innerFind(_keys[base + i], hashes[i]));
+		}
+	}
+
+	template<typename K>
+	void markEqualRange(const K& _key, NodeType*& _first, NodeType*& _last) const noexcept
+	{
+		_first = _last = innerFind(_key, hasher(_key));
+	}
+
+	//Insertion---------------------------------------------------------------------------------------------------------------------------------
+
+	//     _key ,   ,    (hash, _args...).    ,
+	//  ,    .       true,   
+	template<typename K, typename... Args>
+	std::pair<NodeType*, bool> innerEmplace(const K& _key, Args&&... _args)
+	{
+		size_t hash = hasher(_key);
+		NodeType* res = innerFind(_key, hash);
+
+		if (res != endPtr)
+			return { res, false };
+
+		return { placeNewEntry(hash, std::forward<Args>(_args)...), true };
+	}
+
+	template<typename KT>
+	NodeType* innerSetInsert(KT&& _key)
+	{
+		std::pair<NodeType*, bool> res = innerEmplace(_key, std::forward<KT>(_key));
+
+		//         endPtr
+		return res.second ? res.first : endPtr;
+	}
+
+	template<typename KT, typename VT>
+	NodeType* innerMapInsert(KT&& _key, VT&& _value)
+	{
+		std::pair<NodeType*, bool> res = innerEmplace(_key, std::forward<KT>(_key), std::forward<VT>(_value));
+
+		//         endPtr
+		return res.second ? res.first : endPtr;
+	}
+
+	template<typename Pair>
+	NodeType* innerMapPairInsert(Pair&& _pair)
+	{
+		std::pair<NodeType*, bool> res = innerEmplace(_pair.first, std::forward<Pair>(_pair));
+
+		//         endPtr
+		return res.second ? res.first : endPtr;
+	}
+
+	//Bulk Build--------------------------------------------------------------------------------------------------------------------------------
+
+	//     [_first, _last), _getKey(*_first)   .
+	//       ,      
+	template<typename InputIterator, typename GetKey>
+	void innerBuild(InputIterator _first, InputIterator _last, const BuildOptions& _options, GetKey _getKey)
+	{
+		clear();
+
+		if (std::is_base_of<std::forward_iterator_tag, typename std::iterator_traits<InputIterator>::iterator_category>::value)
+			reserve(static_cast<size_t>(std::distance(_first, _last)));
+
+		for (; _first != _last; ++_first)
+		{
+			const KeyType& key = _getKey(*_first);
+			size_t hash = hasher(key);
+
+			if (!_options.uniqueKeys && innerFind(key, hash) != endPtr)
+				continue;
+
+			placeNewEntry(hash, *_first);
+		}
+	}
+
+	//Erasing-----------------------------------------------------------------------------------------------------------------------------------
+
+	template<typename K>
+	size_t innerEraseKey(const K& _key)
+	{
+		NodeType* res = innerFind(_key, hasher(_key));
+
+		if (res == endPtr)
+			return 0;
+
+		return eraseSingleNode(res);
+	}
+
+	//   multi,     _key   
+	template<typename K>
+	size_t innerEraseEqual(const K& _key)
+	{
+		return innerEraseKey(_key);
+	}
+
+	void eraseBucket(size_t _pos) noexcept
+	{
+		size_t mask = bucketCount - 1;
+		size_t hole = _pos;
+		size_t pos = (_pos + 1) & mask;
+
+		//  : ,        ,  ,   
+		while (bucketArray[pos] != emptyBucket)
+		{
+			size_t home = firstBucket(infoArray[bucketArray[pos]].hash);
+
+			if (((pos - home) & mask) >= ((pos - hole) & mask))
+			{
+				bucketArray[hole] = bucketArray[pos];
+				hole = pos;
+			}
+
+			pos = (pos + 1) & mask;
+		}
+
+		bucketArray[hole] = emptyBucket;
+	}
+
+	size_t eraseSingleNode(NodeType* _node)
+	{
+		size_t entryIndex = static_cast<size_t>(_node - entryArray);
+		size_t mask = bucketCount - 1;
+		size_t pos = firstBucket(infoArray[entryIndex].hash);
+
+		while (bucketArray[pos] != entryIndex)
+			pos = (pos + 1) & mask;
+
+		eraseBucket(pos);
+
+		//   ,       
+		_node->~NodeType();
+		infoArray[entryIndex].erased = true;
+		++erasedCount;
+		--elementCount;
+
+		//       
+		while (entryCount > 0 && infoArray[entryCount - 1].erased)
+		{
+			--entryCount;
+			--erasedCount;
+		}
+
+		checkLoadFactor();
+
+		return 1;
+	}
+
+	//Iterator Functional-----------------------------------------------------------------------------------------------------------------------
+
+	NodeType* findLiveFrom(size_t _index) const noexcept
+	{
+		for (; _index < entryCount; ++_index)
+		{
+			if (!infoArray[_index].erased)
+				return entryArray + _index;
+		}
+
+		return endPtr;
+	}
+
+	NodeType* findLiveBefore(size_t _index) const noexcept
+	{
+		while (_index > 0)
+		{
+			--_index;
+
+			if (!infoArray[_index].erased)
+				return entryArray + _index;
+		}
+
+		return beforeBeginPtr;
+	}
+
+	NodeType* getBegin() const noexcept
+	{
+		if (elementCount == 0)
+			return endPtr;
+
+		return findLiveFrom(0);
+	}
+
+	NodeType* getBack() const noexcept
+	{
+		if (elementCount == 0)
+			return endPtr;
+
+		return findLiveBefore(entryCount);
+	}
+
+	void toNext(NodeType*& _current) const noexcept
+	{
+		if (_current == endPtr)
+			return;
+
+		if (_current == beforeBeginPtr)
+		{
+			_current = getBegin();
+			return;
+		}
+
+		_current = findLiveFrom(static_cast<size_t>(_current - entryArray) + 1);
+	}
+
+	void toPrev(NodeType*& _current) const noexcept
+	{
+		if (_current == beforeBeginPtr)
+			return;
+
+		if (_current == endPtr)
+		{
+			_current = (elementCount == 0) ? beforeBeginPtr : getBack();
+			return;
+		}
+
+		_current = findLiveBefore(static_cast<size_t>(_current - entryArray));
+	}
+
+//Public Methods--------------------------------------------------------------------------------------------------------------------------------
+public:
+
+	//Getting Properties------------------------------------------------------------------------------------------------------------------------
+
+	size_t size() const noexcept
+	{
+		return elementCount;
+	}
+
+	size_t getBucketCount() const noexcept
+	{
+		return bucketCount;
+	}
+
+	bool isEmpty() const noexcept
+	{
+		return (elementCount == 0) ? true : false;
+	}
+
+	float getLoadFactor() const noexcept
+	{
+		return loadFactor;
+	}
+
+	float getMaxLoadFactor() const noexcept
+	{
+		return maxLoadFactor;
+	}
+
+	float getGainFactor() const noexcept
+	{
+		return gainFactor;
+	}
+
+	float getMinLoadFactor() const noexcept
+	{
+		return minLoadFactor;
+	}
+
+	Allocator getAllocator() const noexcept
+	{
+		return allocator;
+	}
+
+	//  - ,  -        (      )
+	HashTableMemoryUsage getMemoryUsage() const noexcept
+	{
+		HashTableMemoryUsage usage;
+		usage.bucketBytes = bucketCount * sizeof(size_t);
+		usage.nodeBytes = entryCapacity * (sizeof(NodeType) + sizeof(EntryInfo));
+		usage.payloadBytes = elementCount * sizeof(typename NodeType::PayloadType);
+		usage.totalBytes = usage.bucketBytes + usage.nodeBytes;
+
+		return usage;
+	}
+
+	//Setting Properties------------------------------------------------------------------------------------------------------------------------
+
+	void reserve(size_t _requiredElementCount) noexcept
+	{
+		size_t requiredBucketCount = normalizeBucketCount(static_cast<size_t>(_requiredElementCount / maxLoadFactor) + 1);
+
+		//       _requiredElementCount,   
+		if (_requiredElementCount == 0 || requiredBucketCount <= bucketCount)
+			return;
+
+		reCreate(requiredBucketCount);
+	}
+
+	bool setBucketCount(size_t _newBucketCount) noexcept
+	{
+		//  _newBucketCount     elementCount,   
+		if (_newBucketCount <= (elementCount / maxLoadFactor))
+			return false;
+
+		reCreate(normalizeBucketCount(_newBucketCount));
+		return true;
+	}
+
+	bool setMaxLoadFactor(float _newMaxLoadFactor) noexcept
+	{
+		//    maxLoadFactor     (0.0, 1.0)
+		if (_newMaxLoadFactor <= 0.0f || _newMaxLoadFactor >= 1.0f || !isValidMinLoadFactor(minLoadFactor, _newMaxLoadFactor, gainFactor))
+			return false;
+
+		maxLoadFactor = _newMaxLoadFactor;
+
+		//     ,     
+		if (bucketCount == 0)
+			return true;
+
+		//      maxLoadFactor
+		size_t requiredBucketCount = normalizeBucketCount(static_cast<size_t>(elementCount / maxLoadFactor) + 1);
+		reCreate((requiredBucketCount > bucketCount) ? requiredBucketCount : bucketCount);
+
+		return true;
+	}
+
+	bool setGainFactor(float _newGainFactor) noexcept
+	{
+		// gainFactor     0.0
+		if (_newGainFactor <= 0.0f || !isValidMinLoadFactor(minLoadFactor, maxLoadFactor, _newGainFactor))
+			return false;
+
+		gainFactor = _newGainFactor;
+		return true;
+	}
+
+	//  loadFactor    minLoadFactor,  . 0  
+	bool setMinLoadFactor(float _newMinLoadFactor) noexcept
+	{
+		if (!isValidMinLoadFactor(_newMinLoadFactor, maxLoadFactor, gainFactor))
+			return false;
+
+		minLoadFactor = _newMinLoadFactor;
+		checkShrink();
+		return true;
+	}
+
+	//Modifying---------------------------------------------------------------------------------------------------------------------------------
+
+	void clear()
+	{
+		destroyEntries();
+
+		//       ,    
+		if (bucketCount / DefProps::sparseClearRatio > elementCount)
+		{
+			clearEntryBuckets();
+		}
+		else
+		{
+			for (size_t i = 0; i < bucketCount; ++i)
+				bucketArray[i] = emptyBucket;
+		}
+
+		entryCount = 0;
+		elementCount = 0;
+		erasedCount = 0;
+		checkLoadFactor();
+	}
+
+	void shrinkToFit() noexcept
+	{
+		//          
+		if (elementCount == 0)
+		{
+			clear();
+			freeArrays(entryArray, infoArray, bucketArray, entryCapacity, bucketCount);
+			setEmptyArrays();
+			checkLoadFactor();
+			return;
+		}
+
+		reCreate(normalizeBucketCount(static_cast<size_t>(elementCount / maxLoadFactor) + 1));
+	}
+
+	void swap(OrderedTable& _other) noexcept
+	{
+		std::swap(entryArray, _other.entryArray);
+		std::swap(infoArray, _other.infoArray);
+		std::swap(bucketArray, _other.bucketArray);
+		std::swap(bucketCount, _other.bucketCount);
+		std::swap(entryCapacity, _other.entryCapacity);
+		std::swap(entryCount, _other.entryCount);
+		std::swap(elementCount, _other.elementCount);
+		std::swap(erasedCount, _other.erasedCount);
+		std::swap(loadFactor, _other.loadFactor);
+		std::swap(maxLoadFactor, _other.maxLoadFactor);
+		std::swap(gainFactor, _other.gainFactor);
+		std::swap(minLoadFactor, _other.minLoadFactor);
+
+		swapAllocators(_other, typename std::allocator_traits<Allocator>::propagate_on_container_swap());
+	}
+
+	void merge(OrderedTable& _source) noexcept
+	{
+		//     _source,        _source
+		for (size_t i = 0; i < _source.entryCount; ++i)
+		{
+			if (_source.infoArray[i].erased)
+				continue;
+
+			NodeType* sourceEntry = _source.entryArray + i;
+			size_t hash = _source.infoArray[i].hash;
+
+			if (innerFind(sourceEntry->getKey(), hash) != endPtr)
+				continue;
+
+			prepareInsert();
+
+			new (entryArray + entryCount) NodeType(std::move(*sourceEntry));
+			commitEntry(hash);
+
+			_source.eraseSingleNode(sourceEntry);
+		}
+	}
+
+	//Search------------------------------------------------------------------------------------------------------------------------------------
+
+	bool contains(const KeyType& _key) const noexcept
+	{
+		return innerFind(_key, hasher(_key)) != endPtr;
+	}
+
+	template<typename K, typename = EnableTransparentLookup<Hasher, EqualComp, K>>
+	bool contains(const K& _key) const noexcept
+	{
+		return innerFind(_key, hasher(_key)) != endPtr;
+	}
+
+	//    _count    _results,     .   
+	size_t containsBatch(const KeyType* _keys, size_t _count, bool* _results) const noexcept
+	{
+		size_t found = 0;
+
+		innerFindBatch(_keys, _count, [this, &found, &_results](NodeType* _node)
+			{
+				*_results = (_node != endPtr);
+				found += *_results++;
+			});
+
+		return found;
+	}
+
+	size_t countByKey(const KeyType& _key) const noexcept
+	{
+		return contains(_key) ? 1 : 0;
+	}
+
+	template<typename K, typename = EnableTransparentLookup<Hasher, EqualComp, K>>
+	size_t countByKey(const K& _key) const noexcept
+	{
+		return contains(_key) ? 1 : 0;
+	}
+
+	//Erasing-----------------------------------------------------------------------------------------------------------------------------------
+
+	size_t eraseEqual(const KeyType& _key)
+	{
+		size_t count = innerEraseEqual(_key);
+		checkShrink();
+
+		return count;
+	}
+
+	template<typename K, typename = EnableTransparentLookup<Hasher, EqualComp, K>>
+	size_t eraseEqual(const K& _key)
+	{
+		size_t count = innerEraseEqual(_key);
+		checkShrink();
+
+		return count;
+	}
+};
+
+#endif // !_ORDERED_TABLE_BASIC_H_
@@ -0,0 +1,188 @@
+#ifndef _PARALLEL_FOR_H_
+#define _PARALLEL_FOR_H_
+
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <vector>
+#include <exception>
+#include <system_error>
+#include <utility>
+
+namespace BHT_NAMESPACE
+{
+	struct ParallelDefaultProperties
+	{
+		//   (, , )     
+		static size_t chunkSize()
+		{
+			return 4096;
+		}
+	};
+
+
+	//       (  1)
+	inline size_t defaultThreadCount() noexcept
+	{
+		unsigned count = std::thread::hardware_concurrency();
+		return (count == 0) ? 1 : static_cast<size_t>(count);
+	}
+
+	//  _func(i)   i  [0, _taskCount),     ( 0 -  ).
+	//     ,     .    
+	//  ,        
+	template<typename Func>
+	void parallelFor(size_t _taskCount, Func _func)
+	{
+		std::exception_ptr error;
+		std::mutex errorMutex;
+
+		auto runTask = [&_func, &error, &errorMutex](size_t _task)
+		{
+			try
+			{
+				_func(_task);
+			}
+			catch (...)
+			{
+				std::lock_guard<std::mutex> lock(errorMutex);
+
+				if (!error)
+					error = std::current_exception();
+			}
+		};
+
+		std::vector<std::thread> threads;
+
+		for (size_t i = 1; i < _taskCount; ++i)
+		{
+			try
+			{
+				threads.emplace_back(runTask, i);
+			}
+			catch (const std::system_error&)
+			{
+				runTask(i);
+			}
+			catch (const std::bad_alloc&)
+			{
+				runTask(i);
+			}
+		}
+
+		if (_taskCount > 0)
+			runTask(0);
+
+		for (std::thread& thread : threads)
+			thread.join();
+
+		if (error)
+			std::rethrow_exception(error);
+	}
+
+
+	//  [0, _unitCount)    ParallelDefaultProperties::chunkSize()     
+	// _func(thread, first, last)  _threadCount (0 - defaultThreadCount()).
+	//       ,  ,  () 
+	//     .     ,    
+	//      
+	template<typename Func>
+	void parallelForChunks(size_t _unitCount, size_t _threadCount, Func _func)
+	{
+		struct alignas(64) ChunkRange
+		{
+			std::atomic<size_t> next{ 0 };
+			size_t end = 0;
+		};
+
+		size_t chunkSize = ParallelDefaultProperties::chunkSize();
+		size_t chunkCount = (_unitCount + chunkSize - 1) / chunkSize;
+
+		if (_threadCount == 0)
+			_threadCount = defaultThreadCount();
+
+		if (_threadCount > chunkCount)
+			_threadCount = chunkCount;
+
+		if (_threadCount == 0)
+			return;
+
+		std::vector<ChunkRange> ranges(_threadCount);
+
+		for (size_t i = 0; i < _threadCount; ++i)
+		{
+			ranges[i].next.store(chunkCount * i / _threadCount, std::memory_order_relaxed);
+			ranges[i].end = chunkCount * (i + 1) / _threadCount;
+		}
+
+		parallelFor(_threadCount, [&](size_t _thread)
+			{
+				//   ,      
+				for (size_t i = 0; i < _threadCount; ++i)
+				{
+					ChunkRange& range = ranges[(_thread + i) % _threadCount];
+
+					for (size_t chunk = range.next.fetch_add(1, std::memory_order_relaxed); chunk < range.end;
+						chunk = range.next.fetch_add(1, std::memory_order_relaxed))
+					{
+						size_t first = chunk * chunkSize;
+						size_t last = (first + chunkSize < _unitCount) ? first + chunkSize : _unitCount;
+
+						_func(_thread, first, last);
+					}
+				}
+			});
+	}
+
+
+	//     parallelReduce, ,     -
+	template<typename T>
+	struct alignas(64) ParallelPartial
+	{
+		T value;
+		bool hasValue = false;
+
+		explicit ParallelPartial(const T& _init) : value(_init) {};
+
+		template<typename Combine>
+		void add(T&& _value, Combine& _combine)
+		{
+			if (hasValue)
+			{
+				value = _combine(std::move(value), std::move(_value));
+			}
+			else
+			{
+				value = std::move(_value);
+				hasValue = true;
+			}
+		}
+	};
+
+	//   : _chunkFunc(first, last, partial)   partial(ParallelPartial<T>&) 
+	//    partial.add(value, _combine).      _init  .
+	// _combine     , .     
+	template<typename T, typename Combine, typename ChunkFunc>
+	T parallelReduceChunks(size_t _unitCount, size_t _threadCount, T _init, Combine _combine, ChunkFunc _chunkFunc)
+	{
+		if (_threadCount == 0)
+			_threadCount = defaultThreadCount();
+
+		std::vector<ParallelPartial<T>> partials(_threadCount, ParallelPartial<T>(_init));
+
+		parallelForChunks(_unitCount, _threadCount, [&partials, &_chunkFunc](size_t _thread, size_t _first, size_t _last)
+			{
+				_chunkFunc(_first, _last, partials[_thread]);
+			});
+
+		for (ParallelPartial<T>& partial : partials)
+		{
+			if (partial.hasValue)
+				_init = _combine(std::move(_init), std::move(partial.value));
+		}
+
+		return _init;
+	}
+}
+
+#endif // !_PARALLEL_FOR_H_
@@ -0,0 +1,288 @@
+#ifndef _PERFECT_HASH_H_
+#define _PERFECT_HASH_H_
+
+#include <cstdint>
+#include <vector>
+#include <algorithm>
+#include <utility>
+
+namespace BHT_NAMESPACE
+{
+	struct PerfectHashDefaultProperties
+	{
+		//     ,     (pilot).
+		//  -    ,   
+		static constexpr size_t averageGroupSize = 4;
+
+		//   :         ,
+		//    ,         
+		static constexpr double loadFactor = 0.99;
+
+		//  ,         seed
+		static constexpr uint32_t maxPilot = 1u << 20;
+	};
+
+
+	//  splitmix64:    64- 
+	inline uint64_t mixPerfectHash(uint64_t _value) noexcept
+	{
+		_value ^= _value >> 30;
+		_value *= 0xBF58476D1CE4E5B9ull;
+		_value ^= _value >> 27;
+		_value *= 0x94D049BB133111EBull;
+		return _value ^ (_value >> 31);
+	}
+
+	//  64  , .. _value,   [0, _range)(Lemire, fastrange)
+	inline uint64_t mulHigh64(uint64_t _value, uint64_t _range) noexcept
+	{
+#if defined(__SIZEOF_INT128__)
+		return static_cast<uint64_t>((static_cast<unsigned __int128>(_value) * _range) >> 64);
+#else
+		uint64_t valueLow = _value & 0xFFFFFFFFull, valueHigh = _value >> 32;
+		uint64_t rangeLow = _range & 0xFFFFFFFFull, rangeHigh = _range >> 32;
+
+		uint64_t lowLow = valueLow * rangeLow;
+		uint64_t highLow = valueHigh * rangeLow;
+		uint64_t lowHigh = valueLow * rangeHigh;
+		uint64_t middle = (lowLow >> 32) + (highLow & 0xFFFFFFFFull) + (lowHigh & 0xFFFFFFFFull);
+
+		return valueHigh * rangeHigh + (highLow >> 32) + (lowHigh >> 32) + (middle >> 32);
+#endif
+	}
+
+
+	//   -   PTHash:  n    [0, n)  .
+	//    (  averageGroupSize),     (pilot),  
+	//     .      .  :
+	//   position = fastrange(mix(mix(hash ^ seed)) ^ pilot * golden, tableSize),  pilot -   ,
+	//  >= n(  1%)     < n  remap.
+	//   -  ,   , ,  remap
+	class PerfectHashIndex
+	{
+		using DefProps = PerfectHashDefaultProperties;
+
+		std::vector<uint32_t> pilots;
+		std::vector<uint64_t> remap;
+		uint64_t seed = 0;
+		uint64_t groupCount = 0;
+		uint64_t tableSize = 0;
+		uint64_t slotCount = 0;
+
+		uint64_t groupKey(size_t _hash) const noexcept
+		{
+			return mixPerfectHash(static_cast<uint64_t>(_hash) ^ seed);
+		}
+
+		uint64_t tablePosition(uint64_t _groupKey, uint32_t _pilot) const noexcept
+		{
+			return mulHigh64(mixPerfectHash(_groupKey) ^ (_pilot * 0x9E3779B97F4A7C15ull), tableSize);
+		}
+
+		//        seed.  false,  -    maxPilot 
+		bool placeGroups(const std::vector<uint64_t>& _keys, const std::vector<size_t>& _groupStarts, const std::vector<size_t>& _items,
+			std::vector<bool>& _taken)
+		{
+			//     ,   
+			size_t maxGroupSize = 0;
+			for (size_t g = 0; g < groupCount; ++g)
+				maxGroupSize = (std::max)(maxGroupSize, _groupStarts[g + 1] - _groupStarts[g]);
+
+			std::vector<size_t> sizeStarts(maxGroupSize + 2, 0);
+			for (size_t g = 0; g < groupCount; ++g)
+				++sizeStarts[maxGroupSize - (_groupStarts[g + 1] - _groupStarts[g]) + 1];
+
+			for (size_t i = 1; i < sizeStarts.size(); ++i)
+				sizeStarts[i] += sizeStarts[i - 1];
+
+			std::vector<size_t> groupOrder(groupCount);
+			for (size_t g = 0; g < groupCount; ++g)
+				groupOrder[sizeStarts[maxGroupSize - (_groupStarts[g + 1] - _groupStarts[g])]++] = g;
+
+			std::vector<uint64_t> positions(maxGroupSize);
+
+			for (size_t g : groupOrder)
+			{
+				size_t first = _groupStarts[g];
+				size_t count = _groupStarts[g + 1] - first;
+
+				if (count == 0)
+					break; //    
+
+				uint32_t pilot = 0;
+
+				for (;; ++pilot)
+				{
+					if (pilot == DefProps::maxPilot)
+						return false;
+
+					bool isFree = true;
+
+					for (size_t i = 0; i < count && isFree; ++i)
+					{
+						positions[i] = tablePosition(_keys[_items[first + i]], pilot);
+						isFree = !_taken[positions[i]];
+
+						for (size_t j = 0; j < i && isFree; ++j)
+							isFree = positions[j] != positions[i];
+					}
+
+					if (isFree)
+						break;
+				}
+
+				for (size_t i = 0; i < count; ++i)
+					_taken[positions[i]] = true;
+
+				pilots[g] = pilot;
+			}
+
+			return true;
+		}
+
+	public:
+
+		static constexpr size_t npos = ~size_t(0);
+
+		//     _hashes.  _order   : _order[i]  i < getSlotCount() -
+		//  ,   i,       (    ),
+		//   .  _overflowHashes       
+		void build(const std::vector<size_t>& _hashes, std::vector<size_t>& _order, std::vector<size_t>& _overflowHashes)
+		{
+			size_t count = _hashes.size();
+
+			groupCount = std::max<uint64_t>(1, (count + DefProps::averageGroupSize - 1) / DefProps::averageGroupSize);
+			pilots.assign(static_cast<size_t>(groupCount), 0);
+
+			std::vector<uint64_t> keys(count);
+			std::vector<size_t> groupStarts(static_cast<size_t>(groupCount) + 1);
+			std::vector<size_t> items(count);
+			std::vector<size_t> duplicates;
+			std::vector<bool> taken;
+
+			for (seed = 0;; ++seed)
+			{
+				//     
+				std::fill(groupStarts.begin(), groupStarts.end(), 0);
+
+				for (size_t i = 0; i < count; ++i)
+				{
+					keys[i] = groupKey(_hashes[i]);
+					++groupStarts[static_cast<size_t>(mulHigh64(keys[i], groupCount)) + 1];
+				}
+
+				for (size_t g = 1; g <= groupCount; ++g)
+					groupStarts[g] += groupStarts[g - 1];
+
+				std::vector<size_t> cursors(groupStarts.begin(), groupStarts.end() - 1);
+				for (size_t i = 0; i < count; ++i)
+					items[cursors[static_cast<size_t>(mulHigh64(keys[i], groupCount))]++] = i;
+
+				//      :    ,    
+				duplicates.clear();
+				size_t write = 0;
+
+				for (size_t g = 0; g < groupCount; ++g)
+				{
+					size_t first = groupStarts[g];
+					size_t last = groupStarts[g + 1];
+
+					std::sort(items.begin() + first, items.begin() + last, [&_hashes](size_t _left, size_t _right)
+						{
+							return _hashes[_left] < _hashes[_right] || (_hashes[_left] == _hashes[_right] && _left < _right);
+						});
+
+					groupStarts[g] = write;
+
+					for (size_t i = first; i < last; ++i)
+					{
+						if (i > first && _hashes[items[i]] == _hashes[items[i - 1]])
+							duplicates.push_back(items[i]);
+						else
+							items[write++] = items[i];
+					}
+				}
+
+				groupStarts[static_cast<size_t>(groupCount)] = write;
+
+				slotCount = write;
+				tableSize = std::max<uint64_t>(slotCount, static_cast<uint64_t>(slotCount / DefProps::loadFactor));
+				taken.assign(static_cast<size_t>(tableSize), false);
+
+				if (placeGroups(keys, groupStarts, items, taken))
+					break;
+			}
+
+			//   >= slotCount     < slotCount  
+			remap.assign(static_cast<size_t>(tableSize - slotCount), 0);
+
+			size_t freePosition = 0;
+			for (uint64_t position = slotCount; position < tableSize; ++position)
+			{
+				if (!taken[position])
+					continue;
+
+				while (taken[freePosition])
+					++freePosition;
+
+				remap[position - slotCount] = freePosition++;
+			}
+
+			_order.assign(count, npos);
+
+			for (size_t g = 0; g < groupCount; ++g)
+			{
+				for (size_t i = groupStarts[g]; i < groupStarts[g + 1]; ++i)
+					_order[static_cast<size_t>(position(_hashes[items[i]]))] = items[i];
+			}
+
+			std::sort(duplicates.begin(), duplicates.end(), [&_hashes](size_t _left, size_t _right)
+				{
+					return _hashes[_left] < _hashes[_right] || (_hashes[_left] == _hashes[_right] && _left < _right);
+				});
+
+			_overflowHashes.resize(duplicates.size());
+
+			for (size_t i = 0; i < duplicates.size(); ++i)
+			{
+				_order[static_cast<size_t>(slotCount) + i] = duplicates[i];
+				_overflowHashes[i] = _hashes[duplicates[i]];
+			}
+		}
+
+		//    [0, getSlotCount()).  ,    , -      
+		size_t position(size_t _hash) const noexcept
+		{
+			uint64_t key = groupKey(_hash);
+			uint64_t res = tablePosition(key, pilots[static_cast<size_t>(mulHigh64(key, groupCount))]);
+
+			if (res >= slotCount)
+				res = remap[static_cast<size_t>(res - slotCount)];
+
+			return static_cast<size_t>(res);
+		}
+
+		size_t getSlotCount() const noexcept
+		{
+			return static_cast<size_t>(slotCount);
+		}
+
+		// ,     
+		size_t getMemoryBytes() const noexcept
+		{
+			return pilots.capacity() * sizeof(uint32_t) + remap.capacity() * sizeof(uint64_t);
+		}
+
+		void swap(PerfectHashIndex& _other) noexcept
+		{
+			pilots.swap(_other.pilots);
+			remap.swap(_other.remap);
+			std::swap(seed, _other.seed);
+			std::swap(groupCount, _other.groupCount);
+			std::swap(tableSize, _other.tableSize);
+			std::swap(slotCount, _other.slotCount);
+		}
+	};
+}
+
+#endif // !_PERFECT_HASH_H_
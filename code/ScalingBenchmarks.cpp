@@ -0,0 +1,455 @@
+//    :       1..N .
+//
+// (  code): g++ -O2 -std=c++17 -DNDEBUG -pthread ScalingBenchmarks.cpp -o ScalingBenchmarks
+//
+// :
+//   shared-find               (const   
+//                      ,   -  )
+//   shared-iterate        
+//   shared-insert           (  )
+//   private-insert       :      
+//   private-find          
+//
+// ( ,   ):
+//   --containers=HashMap,SwissHashMap,OrderedHashMap,std::unordered_map,ConcurrentHashMap,LockFreeReadHashMap
+//   --scenarios=shared-find,shared-iterate,shared-insert,private-insert,private-find
+//   --threads=1,2,4,...                           
+//   --size=1M                             ( shared-insert -   )
+//   --ops=4M                               ( shared-iterate -    )
+//   --pin=yes                              i    i
+//   --csv                                  CSV
+//
+//    (weak scaling),        
+//   .  -       
+//   .     Subject    runContainers
+
+#include <cstdio>
+#include <string>
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <memory>
+#include <unordered_map>
+
+#include "HashMap.h"
+#include "ConcurrentHashMap.h"
+#include "LockFreeReadHashMap.h"
+#include "BenchmarkUtils.h"
+
+using namespace BenchmarkUtils;
+
+namespace
+{
+	//Subjects----------------------------------------------------------------------------------------------------------------------------------
+
+	//   . isConcurrent -       ,
+	// canIterate -     
+	template<typename Container>
+	struct Subject
+	{
+		static constexpr bool isConcurrent = false;
+		static constexpr bool canIterate = true;
+
+		static void insert(Container& _container, uint64_t _key)
+		{
+			_container.insert(_key, _key);
+		}
+
+		static bool contains(const Container& _container, uint64_t _key)
+		{
+			return _container.contains(_key);
+		}
+
+		static uint64_t sumValues(const Container& _container)
+		{
+			uint64_t sum = 0;
+
+			for (const auto& elem : _container)
+				sum += elem.second;
+
+			return sum;
+		}
+	};
+
+	template<>
+	struct Subject<std::unordered_map<uint64_t, uint64_t>>
+	{
+		using Container = std::unordered_map<uint64_t, uint64_t>;
+
+		static constexpr bool isConcurrent = false;
+		static constexpr bool canIterate = true;
+
+		static void insert(Container& _container, uint64_t _key)
+		{
+			_container.emplace(_key, _key);
+		}
+
+		static bool contains(const Container& _container, uint64_t _key)
+		{
+			return _container.find(_key) != _container.end();
+		}
+
+		static uint64_t sumValues(const Container& _container)
+		{
+			uint64_t sum = 0;
+
+			for (const auto& elem : _container)
+				sum += elem.second;
+
+			return sum;
+		}
+	};
+
+	template<>
+	struct Subject<ConcurrentHashMap<uint64_t, uint64_t>>
+	{
+		using Container = ConcurrentHashMap<uint64_t, uint64_t>;
+
+		static constexpr bool isConcurrent = true;
+		static constexpr bool canIterate = true;
+
+		static void insert(Container& _container, uint64_t _key)
+		{
+			_container.insert(_key, _key);
+		}
+
+		static bool contains(const Container& _container, uint64_t _key)
+		{
+			return _container.contains(_key);
+		}
+
+		static uint64_t sumValues(const Container& _container)
+		{
+			uint64_t sum = 0;
+			_container.visitAll([&sum](const uint64_t&, const uint64_t& _value) { sum += _value; });
+
+			return sum;
+		}
+	};
+
+	template<>
+	struct Subject<LockFreeReadHashMap<uint64_t, uint64_t>>
+	{
+		using Container = LockFreeReadHashMap<uint64_t, uint64_t>;
+
+		static constexpr bool isConcurrent = true;
+		static constexpr bool canIterate = false;
+
+		static void insert(Container& _container, uint64_t _key)
+		{
+			_container.insert(_key, _key);
+		}
+
+		static bool contains(const Container& _container, uint64_t _key)
+		{
+			return _container.contains(_key);
+		}
+
+		static uint64_t sumValues(const Container&)
+		{
+			return 0;
+		}
+	};
+
+	//Options-----------------------------------------------------------------------------------------------------------------------------------
+
+	struct Options
+	{
+		std::vector<std::string> containers;
+		std::vector<std::string> scenarios;
+		std::vector<size_t> threadCounts;
+		size_t size = 1000000;
+		size_t ops = 4000000;
+		bool isPinned = true;
+		bool isCsv = false;
+	};
+
+	Options parseOptions(int _argc, char** _argv)
+	{
+		Options options;
+
+		options.containers = splitList(getArgument(_argc, _argv, "containers",
+			"HashMap,SwissHashMap,OrderedHashMap,std::unordered_map,ConcurrentHashMap,LockFreeReadHashMap"));
+		options.scenarios = splitList(getArgument(_argc, _argv, "scenarios",
+			"shared-find,shared-iterate,shared-insert,private-insert,private-find"));
+		options.size = std::max<size_t>(parseSize(getArgument(_argc, _argv, "size", "1M")), 1);
+		options.ops = std::max<size_t>(parseSize(getArgument(_argc, _argv, "ops", "4M")), 1);
+		options.isPinned = getArgument(_argc, _argv, "pin", "yes") != "no";
+		options.isCsv = hasFlag(_argc, _argv, "csv");
+
+		std::string threads = getArgument(_argc, _argv, "threads", "");
+
+		if (threads.empty())
+		{
+			size_t hardwareCount = BHT_NAMESPACE::defaultThreadCount();
+
+			for (size_t count = 1; count < hardwareCount; count *= 2)
+				options.threadCounts.push_back(count);
+
+			options.threadCounts.push_back(hardwareCount);
+		}
+		else
+		{
+			for (const std::string& count : splitList(threads))
+				options.threadCounts.push_back(std::max<size_t>(parseSize(count), 1));
+		}
+
+		return options;
+	}
+
+	//Threads-----------------------------------------------------------------------------------------------------------------------------------
+
+	//  _threadCount .     ( _isPinned),  _setup(t),
+	//     _work(t).         _work  ,
+	//     
+	template<typename Setup, typename Work>
+	double runThreads(size_t _threadCount, bool _isPinned, Setup _setup, Work _work)
+	{
+		std::atomic<size_t> readyCount{ 0 };
+		std::atomic<bool> isStarted{ false };
+		std::vector<Clock::time_point> ends(_threadCount);
+		std::vector<std::thread> threads;
+
+		for (size_t t = 0; t < _threadCount; ++t)
+		{
+			threads.emplace_back([&, t]()
+				{
+					if (_isPinned)
+						pinCurrentThread(t);
+
+					_setup(t);
+
+					readyCount.fetch_add(1, std::memory_order_acq_rel);
+					while (!isStarted.load(std::memory_order_acquire))
+						std::this_thread::yield();
+
+					_work(t);
+					ends[t] = Clock::now();
+				});
+		}
+
+		while (readyCount.load(std::memory_order_acquire) != _threadCount)
+			std::this_thread::yield();
+
+		Clock::time_point begin = Clock::now();
+		isStarted.store(true, std::memory_order_release);
+
+		for (std::thread& thread : threads)
+			thread.join();
+
+		return elapsedNanoseconds(begin, *std::max_element(ends.begin(), ends.end()));
+	}
+
+	//    : xorshift64*    [0, _range).  std::uniform_int_distribution
+	//      ,       
+	inline uint64_t nextIndex(uint64_t& _state, uint64_t _range) noexcept
+	{
+		_state ^= _state >> 12;
+		_state ^= _state << 25;
+		_state ^= _state >> 27;
+
+		return BHT_NAMESPACE::mulHigh64(_state * 0x2545F4914F6CDD1Dull, _range);
+	}
+
+	template<typename Container>
+	void fill(Container& _container, size_t _first, size_t _count)
+	{
+		for (size_t i = _first; i < _first + _count; ++i)
+			Subject<Container>::insert(_container, mixKeyId(i));
+	}
+
+	//Measuring---------------------------------------------------------------------------------------------------------------------------------
+
+	void printHeader(const Options& _options)
+	{
+		if (_options.isCsv)
+			std::printf("scenario,container,threads,total_mops,per_thread_mops,efficiency\n");
+		else
+			std::printf("%-16s %-20s %7s %12s %12s %10s\n", "scenario", "container", "threads", "total Mop/s", "Mop/s/thread", "efficiency");
+	}
+
+	//       .  -    
+	void printScenario(const Options& _options, const std::string& _scenario, const std::string& _container,
+		const std::vector<double>& _totalMops)
+	{
+		double basePerThread = _totalMops[0] / _options.threadCounts[0];
+
+		for (size_t i = 0; i < _totalMops.size(); ++i)
+		{
+			double perThread = _totalMops[i] / _options.threadCounts[i];
+
+			const char* format = _options.isCsv ? "%s,%s,%zu,%.2f,%.2f,%.3f\n" : "%-16s %-20s %7zu %12.2f %12.2f %10.3f\n";
+			std::printf(format, _scenario.c_str(), _container.c_str(), _options.threadCounts[i], _totalMops[i], perThread,
+				perThread / basePerThread);
+		}
+
+		std::fflush(stdout);
+	}
+
+	template<typename Container>
+	void runContainer(const Options& _options, const std::string& _name)
+	{
+		using Ops = Subject<Container>;
+
+		if (!listContains(_options.containers, _name))
+			return;
+
+		size_t size = _options.size;
+		size_t ops = _options.ops;
+
+		//    shared-find  shared-iterate   
+		std::unique_ptr<Container> shared;
+
+		if (listContains(_options.scenarios, "shared-find") || listContains(_options.scenarios, "shared-iterate"))
+		{
+			shared.reset(new Container());
+			fill(*shared, 0, size);
+		}
+
+		if (listContains(_options.scenarios, "shared-find"))
+		{
+			std::vector<double> totalMops;
+
+			for (size_t threadCount : _options.threadCounts)
+			{
+				std::vector<size_t> foundCounts(threadCount, 0);
+				const Container& container = *shared;
+
+				double ns = runThreads(threadCount, _options.isPinned, [](size_t) {}, [&](size_t _t)
+					{
+						uint64_t state = mixKeyId(_t + 1);
+						size_t foundCount = 0;
+
+						for (size_t i = 0; i < ops; ++i)
+							foundCount += Ops::contains(container, mixKeyId(nextIndex(state, size)));
+
+						foundCounts[_t] = foundCount;
+					});
+
+				doNotOptimize(foundCounts.data());
+				totalMops.push_back(threadCount * ops * 1000.0 / ns);
+			}
+
+			printScenario(_options, "shared-find", _name, totalMops);
+		}
+
+		if (listContains(_options.scenarios, "shared-iterate") && Ops::canIterate)
+		{
+			std::vector<double> totalMops;
+			size_t passes = std::max<size_t>(ops / size, 1);
+
+			for (size_t threadCount : _options.threadCounts)
+			{
+				std::vector<uint64_t> sums(threadCount, 0);
+				const Container& container = *shared;
+
+				double ns = runThreads(threadCount, _options.isPinned, [](size_t) {}, [&](size_t _t)
+					{
+						for (size_t pass = 0; pass < passes; ++pass)
+							sums[_t] += Ops::sumValues(container);
+					});
+
+				doNotOptimize(sums.data());
+				totalMops.push_back(threadCount * passes * size * 1000.0 / ns);
+			}
+
+			printScenario(_options, "shared-iterate", _name, totalMops);
+		}
+
+		shared.reset();
+
+		if (listContains(_options.scenarios, "shared-insert") && Ops::isConcurrent)
+		{
+			std::vector<double> totalMops;
+
+			for (size_t threadCount : _options.threadCounts)
+			{
+				Container container;
+
+				double ns = runThreads(threadCount, _options.isPinned, [](size_t) {}, [&](size_t _t)
+					{
+						fill(container, _t * size, size);
+					});
+
+				totalMops.push_back(threadCount * size * 1000.0 / ns);
+			}
+
+			printScenario(_options, "shared-insert", _name, totalMops);
+		}
+
+		if (listContains(_options.scenarios, "private-insert"))
+		{
+			std::vector<double> totalMops;
+
+			for (size_t threadCount : _options.threadCounts)
+			{
+				std::vector<std::unique_ptr<Container>> containers(threadCount);
+
+				//      ,     
+				double ns = runThreads(threadCount, _options.isPinned, [&](size_t _t) { containers[_t].reset(new Container()); },
+					[&](size_t _t)
+					{
+						fill(*containers[_t], 0, size);
+					});
+
+				totalMops.push_back(threadCount * size * 1000.0 / ns);
+			}
+
+			printScenario(_options, "private-insert", _name, totalMops);
+		}
+
+		if (listContains(_options.scenarios, "private-find"))
+		{
+			std::vector<double> totalMops;
+
+			for (size_t threadCount : _options.threadCounts)
+			{
+				std::vector<std::unique_ptr<Container>> containers(threadCount);
+				std::vector<size_t> foundCounts(threadCount, 0);
+
+				//      ,        
+				double ns = runThreads(threadCount, _options.isPinned, [&](size_t _t)
+					{
+						containers[_t].reset(new Container());
+						fill(*containers[_t], 0, size);
+					},
+					[&](size_t _t)
+					{
+						const Container& container = *containers[_t];
+						uint64_t state = mixKeyId(_t + 1);
+						size_t foundCount = 0;
+
+						for (size_t i = 0; i < ops; ++i)
+							foundCount += Ops::contains(container, mixKeyId(nextIndex(state, size)));
+
+						foundCounts[_t] = foundCount;
+					});
+
+				doNotOptimize(foundCounts.data());
+				totalMops.push_back(threadCount * ops * 1000.0 / ns);
+			}
+
+			printScenario(_options, "private-find", _name, totalMops);
+		}
+	}
+
+	void runContainers(const Options& _options)
+	{
+		runContainer<HashMap<uint64_t, uint64_t>>(_options, "HashMap");
+		runContainer<SwissHashMap<uint64_t, uint64_t>>(_options, "SwissHashMap");
+		runContainer<OrderedHashMap<uint64_t, uint64_t>>(_options, "OrderedHashMap");
+		runContainer<std::unordered_map<uint64_t, uint64_t>>(_options, "std::unordered_map");
+		runContainer<ConcurrentHashMap<uint64_t, uint64_t>>(_options, "ConcurrentHashMap");
+		runContainer<LockFreeReadHashMap<uint64_t, uint64_t>>(_options, "LockFreeReadHashMap");
+	}
+}
+
+int main(int _argc, char** _argv)
+{
+	Options options = parseOptions(_argc, _argv);
+
+	printHeader(options);
+	runContainers(options);
+
+	return 0;
+}
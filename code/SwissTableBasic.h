@@ -0,0 +1,1098 @@
+#ifndef _SWISS_TABLE_BASIC_H_
+#define _SWISS_TABLE_BASIC_H_
+
+#include <utility>
+#include <functional>
+#include <memory>
+#include <new>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <iterator>
+
+#include "HashTableBasic.h"
+
+#if !defined(BHT_SWISS_NO_SSE2) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define BHT_SWISS_SSE2 1
+#include <emmintrin.h>
+#endif
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace BHT_NAMESPACE
+{
+	struct SwissTableDefaultProperties
+	{
+		static size_t deafaultBucketCount()
+		{
+			return 64;
+		}
+
+		static float defaultMaxLoadFactor()
+		{
+			return 0.875f;
+		}
+
+		static float defaultGainFactor()
+		{
+			return 2.0f;
+		}
+
+		// 0 -     
+		static float defaultMinLoadFactor()
+		{
+			return 0.0f;
+		}
+
+		//  ,  findBatch/containsBatch   
+		static constexpr size_t findBatchWindow = 16;
+
+		// clear()   (minLoadFactor > 0)      ,
+		//     sparseClearMinBuckets    sparseClearRatio   ( 
+		//  8    ChainedStorage)
+		static constexpr size_t sparseClearMinBuckets = 32768;
+		static constexpr size_t sparseClearRatio = 8;
+	};
+
+
+	//  :  0..127 -  ( 7  ),  - 
+	struct SwissControl
+	{
+		static constexpr int8_t empty = -128;
+		static constexpr int8_t deleted = -2;
+	};
+
+
+	inline uint32_t swissCountTrailingZeros(uint32_t _mask) noexcept
+	{
+#if defined(_MSC_VER)
+		unsigned long index = 0;
+		_BitScanForward(&index, _mask);
+		return static_cast<uint32_t>(index);
+#else
+		return static_cast<uint32_t>(__builtin_ctz(_mask));
+#endif
+	}
+
+	inline uint32_t swissCountLeadingZeros16(uint32_t _mask) noexcept
+	{
+#if defined(_MSC_VER)
+		unsigned long index = 0;
+		_BitScanReverse(&index, _mask);
+		return 15 - static_cast<uint32_t>(index);
+#else
+		return static_cast<uint32_t>(__builtin_clz(_mask)) - 16;
+#endif
+	}
+
+
+	//   16  ,   match   ( i -  i )
+	struct SwissGroup
+	{
+		static constexpr size_t width = 16;
+
+#ifdef BHT_SWISS_SSE2
+		__m128i ctrl;
+
+		explicit SwissGroup(const int8_t* _pos) noexcept :
+			ctrl(_mm_loadu_si128(reinterpret_cast<const __m128i*>(_pos))) {};
+
+		uint32_t match(int8_t _h2) const noexcept
+		{
+			return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(_h2), ctrl)));
+		}
+
+		uint32_t matchEmpty() const noexcept
+		{
+			return match(SwissControl::empty);
+		}
+
+		uint32_t matchEmptyOrDeleted() const noexcept
+		{
+			//   ,  empty  deleted  -1
+			return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpgt_epi8(_mm_set1_epi8(-1), ctrl)));
+		}
+
+		uint32_t matchFull() const noexcept
+		{
+			//       
+			return ~static_cast<uint32_t>(_mm_movemask_epi8(ctrl)) & 0xFFFFu;
+		}
+#else
+		int8_t ctrl[width];
+
+		explicit SwissGroup(const int8_t* _pos) noexcept
+		{
+			std::memcpy(ctrl, _pos, width);
+		}
+
+		uint32_t match(int8_t _h2) const noexcept
+		{
+			uint32_t mask = 0;
+			for (size_t i = 0; i < width; ++i)
+				mask |= static_cast<uint32_t>(ctrl[i] == _h2) << i;
+
+			return mask;
+		}
+
+		uint32_t matchEmpty() const noexcept
+		{
+			return match(SwissControl::empty);
+		}
+
+		uint32_t matchEmptyOrDeleted() const noexcept
+		{
+			uint32_t mask = 0;
+			for (size_t i = 0; i < width; ++i)
+				mask |= static_cast<uint32_t>(ctrl[i] < -1) << i;
+
+			return mask;
+		}
+
+		uint32_t matchFull() const noexcept
+		{
+			uint32_t mask = 0;
+			for (size_t i = 0; i < width; ++i)
+				mask |= static_cast<uint32_t>(ctrl[i] >= 0) << i;
+
+			return mask;
+		}
+#endif
+	};
+
+
+	template<bool Multi, typename NodeType, typename Hasher, typename EqualComp, typename Allocator = std::allocator<NodeType>>
+	class SwissTable;
+
+	//    front-end':      
+	struct SwissStorage
+	{
+		static constexpr bool isFlat = true;
+
+		template<bool Multi, typename NodeType, typename Hasher, typename EqualComp, typename Allocator = std::allocator<NodeType>>
+		using Table = SwissTable<Multi, NodeType, Hasher, EqualComp, Allocator>;
+	};
+}
+
+
+template<bool Multi, typename NodeType, typename Hasher, typename EqualComp, typename Allocator>
+class BHT_NAMESPACE::SwissTable
+{
+	static_assert(!Multi, "SwissTable does not support multi containers");
+
+public:
+
+	using AllocatorType = Allocator;
+
+protected:
+
+	using DefProps = SwissTableDefaultProperties;
+	using KeyType = typename NodeType::KeyType;
+	using Group = SwissGroup;
+	using SlotAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<NodeType>;
+	using SlotAllocatorTraits = std::allocator_traits<SlotAllocator>;
+	using CtrlAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<int8_t>;
+	using CtrlAllocatorTraits = std::allocator_traits<CtrlAllocator>;
+
+//Properties(fields)----------------------------------------------------------------------------------------------------------------------------
+
+	static constexpr bool isMulti = Multi;
+	static constexpr size_t groupWidth = Group::width;
+
+	//      ,  : bucketCount  0,    endPtr.
+	//     
+	int8_t* ctrlArray = nullptr; // bucketCount + groupWidth ,  groupWidth   
+	NodeType* slotArray = nullptr;
+
+	size_t bucketCount = 0;
+	size_t elementCount = 0;
+	size_t deletedCount = 0;
+
+	float loadFactor = 0.0f;
+	float maxLoadFactor = DefProps::defaultMaxLoadFactor();
+	float gainFactor = DefProps::defaultGainFactor();
+	float minLoadFactor = DefProps::defaultMinLoadFactor();
+
+	Hasher hasher;
+	EqualComp comp;
+
+	//         rebind  int8_t  NodeType
+	Allocator allocator;
+
+	NodeType* beforeBeginPtr = reinterpret_cast<NodeType*>(SentinelNodes<NodeType>::beforeBegin);
+	NodeType* endPtr = reinterpret_cast<NodeType*>(SentinelNodes<NodeType>::end);
+
+//Protected Methods-----------------------------------------------------------------------------------------------------------------------------
+
+	//Constructors & Destructor-----------------------------------------------------------------------------------------------------------------
+
+	//   ,     
+	SwissTable() : SwissTable(Allocator()) {};
+
+	explicit SwissTable(const Allocator& _allocator) : allocator(_allocator)
+	{
+		if (isValidHasher<KeyType, Hasher> && isValidComparator<KeyType, EqualComp>) {};
+	}
+
+	SwissTable(size_t _bucketCount, const Allocator& _allocator = Allocator()) : SwissTable(_allocator)
+	{
+		reCreate(normalizeBucketCount(_bucketCount));
+	}
+
+	~SwissTable()
+	{
+		destroyAllSlots();
+
+		freeArrays(ctrlArray, slotArray, bucketCount);
+	}
+
+	//Specific Methods--------------------------------------------------------------------------------------------------------------------------
+
+	static size_t normalizeBucketCount(size_t _bucketCount) noexcept
+	{
+		//   -  ,    
+		size_t result = groupWidth;
+		while (result < _bucketCount)
+			result <<= 1;
+
+		return result;
+	}
+
+	static size_t h1(size_t _mixedHash) noexcept
+	{
+		return _mixedHash >> 7;
+	}
+
+	static int8_t h2(size_t _mixedHash) noexcept
+	{
+		return static_cast<int8_t>(_mixedHash & 0x7F);
+	}
+
+	void allocateArrays(size_t _bucketCount)
+	{
+		CtrlAllocator ctrlAllocator(allocator);
+		SlotAllocator slotAllocator(allocator);
+
+		ctrlArray = CtrlAllocatorTraits::allocate(ctrlAllocator, _bucketCount + groupWidth);
+		std::memset(ctrlArray, static_cast<unsigned char>(SwissControl::empty), _bucketCount + groupWidth);
+
+		try
+		{
+			slotArray = SlotAllocatorTraits::allocate(slotAllocator, _bucketCount);
+		}
+		catch (...)
+		{
+			CtrlAllocatorTraits::deallocate(ctrlAllocator, ctrlArray, _bucketCount + groupWidth);
+			ctrlArray = nullptr;
+			throw;
+		}
+	}
+
+	//    ,    (   )
+	void destroyAllSlots() noexcept
+	{
+		if (!std::is_trivially_destructible<NodeType>::value)
+		{
+			for (size_t i = 0; i < bucketCount; ++i)
+			{
+				if (isFull(i))
+					slotArray[i].~NodeType();
+			}
+		}
+	}
+
+	void freeArrays(int8_t* _ctrlArray, NodeType* _slotArray, size_t _bucketCount) noexcept
+	{
+		if (!_ctrlArray)
+			return;
+
+		CtrlAllocator ctrlAllocator(allocator);
+		SlotAllocator slotAllocator(allocator);
+
+		CtrlAllocatorTraits::deallocate(ctrlAllocator, _ctrlArray, _bucketCount + groupWidth);
+		SlotAllocatorTraits::deallocate(slotAllocator, _slotArray, _bucketCount);
+	}
+
+	void swapAllocators(SwissTable& _other, std::true_type) noexcept
+	{
+		using std::swap;
+		swap(allocator, _other.allocator);
+	}
+
+	//   propagate_on_container_swap  ,    
+	void swapAllocators(SwissTable&, std::false_type) noexcept {};
+
+	void setCtrl(size_t _index, int8_t _value) noexcept
+	{
+		ctrlArray[_index] = _value;
+
+		//  groupWidth    ,        
+		if (_index < groupWidth)
+			ctrlArray[bucketCount + _index] = _value;
+	}
+
+	bool isFull(size_t _index) const noexcept
+	{
+		return ctrlArray[_index] >= 0;
+	}
+
+	//    - 
+	size_t visitUnitCount() const noexcept
+	{
+		return bucketCount;
+	}
+
+	//  _func(NodeType*)      [_first, _last)
+	template<typename Func>
+	void forEachNodeInUnits(size_t _first, size_t _last, Func _func) const
+	{
+		for (size_t i = _first; i < _last; ++i)
+		{
+			if (isFull(i))
+				_func(slotArray + i);
+		}
+	}
+
+	size_t growthLimit() const noexcept
+	{
+		size_t limit = static_cast<size_t>(bucketCount * maxLoadFactor);
+
+		//       ,      
+		return (limit < bucketCount) ? limit : bucketCount - 1;
+	}
+
+	void checkLoadFactor() noexcept
+	{
+		loadFactor = (bucketCount != 0) ? static_cast<float>(elementCount) / bucketCount : 0.0f;
+	}
+
+	//      ,   
+	void setEmptyArrays() noexcept
+	{
+		ctrlArray = nullptr;
+		slotArray = nullptr;
+		bucketCount = 0;
+	}
+
+	void prepareInsert() noexcept
+	{
+		if (bucketCount == 0)
+		{
+			reCreate(DefProps::deafaultBucketCount());
+			return;
+		}
+
+		if (elementCount + deletedCount + 1 <= growthLimit())
+			return;
+
+		//     ,      
+		if (elementCount + 1 <= growthLimit() / 2)
+		{
+			reCreate(bucketCount);
+			return;
+		}
+
+		size_t newBucketCount = static_cast<size_t>(bucketCount * gainFactor);
+		reCreate(normalizeBucketCount((newBucketCount > bucketCount) ? newBucketCount : bucketCount + 1));
+	}
+
+	size_t findFirstNonFull(size_t _mixedHash) const noexcept
+	{
+		size_t mask = bucketCount - 1;
+		size_t pos = h1(_mixedHash) & mask;
+		size_t step = 0;
+
+		while (true)
+		{
+			uint32_t candidates = Group(ctrlArray + pos).matchEmptyOrDeleted();
+
+			if (candidates)
+				return (pos + swissCountTrailingZeros(candidates)) & mask;
+
+			step += groupWidth;
+			pos = (pos + step) & mask;
+		}
+	}
+
+	//    .      ,
+	//  loadFactor    ,   
+	void checkShrink() noexcept
+	{
+		if (minLoadFactor == 0.0f || bucketCount == 0 || static_cast<float>(elementCount) / bucketCount >= minLoadFactor)
+			return;
+
+		size_t newBucketCount = normalizeBucketCount(static_cast<size_t>(elementCount * gainFactor / maxLoadFactor) + 1);
+
+		if (newBucketCount < DefProps::deafaultBucketCount())
+			newBucketCount = normalizeBucketCount(DefProps::deafaultBucketCount());
+
+		if (newBucketCount < bucketCount)
+		{
+			reCreate(newBucketCount);
+			checkLoadFactor();
+		}
+	}
+
+	void reCreate(size_t _newBucketCount) noexcept
+	{
+		int8_t* oldCtrlArray = ctrlArray;
+		NodeType* oldSlotArray = slotArray;
+		size_t oldBucketCount = bucketCount;
+
+		bucketCount = _newBucketCount;
+		allocateArrays(bucketCount);
+
+		//    
+		for (size_t i = 0; i < oldBucketCount; ++i)
+		{
+			if (oldCtrlArray[i] < 0)
+				continue;
+
+			size_t mixedHash = mixHash(hasher(oldSlotArray[i].getKey()));
+			size_t index = findFirstNonFull(mixedHash);
+
+			setCtrl(index, h2(mixedHash));
+			new (slotArray + index) NodeType(std::move(oldSlotArray[i]));
+			oldSlotArray[i].~NodeType();
+		}
+
+		deletedCount = 0;
+		checkLoadFactor();
+
+		freeArrays(oldCtrlArray, oldSlotArray, oldBucketCount);
+	}
+
+	size_t prepareSlot(size_t _mixedHash) noexcept
+	{
+		prepareInsert();
+
+		return findFirstNonFull(_mixedHash);
+	}
+
+	NodeType* commitSlot(size_t _index, size_t _mixedHash) noexcept
+	{
+		if (ctrlArray[_index] == SwissControl::deleted)
+			--deletedCount;
+
+		setCtrl(_index, h2(_mixedHash));
+		++elementCount;
+		checkLoadFactor();
+
+		return slotArray + _index;
+	}
+
+	template<typename... Args>
+	NodeType* placeNewSlot(size_t _hash, Args&&... _args)
+	{
+		size_t mixedHash = mixHash(_hash);
+		size_t index = prepareSlot(mixedHash);
+
+		//   ,         
+		new (slotArray + index) NodeType(_hash, std::forward<Args>(_args)...);
+
+		return commitSlot(index, mixedHash);
+	}
+
+	//Construction------------------------------------------------------------------------------------------------------------------------------
+
+	void copyConstruct(const SwissTable& _other)
+	{
+		freeArrays(ctrlArray, slotArray, bucketCount);
+		setEmptyArrays();
+
+		//   _other
+		elementCount = 0;
+		deletedCount = _other.deletedCount;
+		loadFactor = _other.loadFactor;
+		maxLoadFactor = _other.maxLoadFactor;
+		gainFactor = _other.gainFactor;
+		minLoadFactor = _other.minLoadFactor;
+
+		//  _other       
+		if (_other.bucketCount == 0)
+			return;
+
+		allocateArrays(_other.bucketCount);
+		bucketCount = _other.bucketCount;
+
+		//      ,      .   
+		//     :     , 
+		//     
+		for (size_t i = 0; i < bucketCount; ++i)
+		{
+			if (_other.isFull(i))
+			{
+				new (slotArray + i) NodeType(_other.slotArray + i);
+				++elementCount;
+			}
+
+			setCtrl(i, _other.ctrlArray[i]);
+		}
+	}
+
+	//        _other:  _other   
+	void moveConstruct(SwissTable& _other) noexcept
+	{
+		freeArrays(ctrlArray, slotArray, bucketCount);
+
+		//   _other
+		ctrlArray = _other.ctrlArray;
+		slotArray = _other.slotArray;
+		bucketCount = _other.bucketCount;
+		elementCount = _other.elementCount;
+		deletedCount = _other.deletedCount;
+		loadFactor = _other.loadFactor;
+		maxLoadFactor = _other.maxLoadFactor;
+		gainFactor = _other.gainFactor;
+		minLoadFactor = _other.minLoadFactor;
+
+		//  _other  default .     , _other   ,
+		//     
+		_other.setEmptyArrays();
+		_other.maxLoadFactor = DefProps::defaultMaxLoadFactor();
+		_other.gainFactor = DefProps::defaultGainFactor();
+		_other.minLoadFactor = DefProps::defaultMinLoadFactor();
+		_other.elementCount = 0;
+		_other.deletedCount = 0;
+		_other.loadFactor = 0.0f;
+	}
+
+	//Search------------------------------------------------------------------------------------------------------------------------------------
+
+	template<typename K>
+	NodeType* findMixed(const K& _key, size_t _mixedHash) const noexcept
+	{
+		if (bucketCount == 0)
+			return endPtr;
+
+		size_t mask = bucketCount - 1;
+		size_t pos = h1(_mixedHash) & mask;
+		size_t step = 0;
+
+		while (true)
+		{
+			Group group(ctrlArray + pos);
+
+			for (uint32_t match = group.match(h2(_mixedHash)); match; match &= match - 1)
+			{
+				size_t index = (pos + swissCountTrailingZeros(match)) & mask;
+
+				if (comp(_key, slotArray[index].getKey()))
+					return slotArray + index;
+			}
+
+			//     ,        
+			if (group.matchEmpty())
+				return endPtr;
+
+			step += groupWidth;
+			pos = (pos + step) & mask;
+		}
+	}
+
+	NodeType* innerFind(const KeyType& _key, size_t _hash) const noexcept
+	{
+		return findMixed(_key, mixHash(_hash));
+	}
+
+	//  :        KeyType
+	template<typename K, typename = EnableTransparentLookup<Hasher, EqualComp, K>>
+	NodeType* innerFind(const K& _key, size_t _hash) const noexcept
+	{
+		return findMixed(_key, mixHash(_hash));
+	}
+
+	//    findBatchWindow :           ,
+	//    h2  -     .
+	//       _output(NodeType*),    endPtr
+	template<typename Output>
+	void innerFindBatch(const KeyType* _keys, size_t _count, Output _output) const
+	{
+		const size_t window = DefProps::findBatchWindow;
+		const size_t mask = bucketCount - 1;
+		size_t mixedHashes[window];
+
+		if (bucketCount == 0)
+		{
+			for (size_t i = 0; i < _count; ++i)
+				_output(endPtr);
+
+			return;
+		}
+
+		for (size_t base = 0; base < _count; base += window)
+		{
+			size_t windowSize = (_count - base < window) ? _count - base : window;
+
+			for (size_t i = 0; i < windowSize; ++i)
+			{
+				mixedHashes[i] = mixHash(hasher(_keys[base + i]));
+				prefetchRead(ctrlArray + (h1(mixedHashes[i]) & mask));
+			}
+
+			for (size_t i = 0; i < windowSize; ++i)
+			{
+				size_t pos = h1(mixedHashes[i]) & mask;
+				uint32_t match = Group(ctrlArray + pos).match(h2(mixedHashes[i]));
+
+				if (match)
+					prefetchRead(slotArray + ((pos + swissCountTrailingZeros(match)) & mask));
+			}
+
+			for (size_t i = 0; i < windowSize; ++i)
+				_output(findMixed(_keys[base + i], mixedHashes[i]));
+		}
+	}
+
+	template<typename K>
+	void markEqualRange(const K& _key, NodeType*& _first, NodeType*& _last) const noexcept
+	{
+		_first = _last = innerFind(_key, hasher(_key));
+	}
+
+	//Insertion---------------------------------------------------------------------------------------------------------------------------------
+
+	//     _key ,   ,    (hash, _args...).    ,
+	//  ,    .       true,   
+	template<typename K, typename... Args>
+	std::pair<NodeType*, bool> innerEmplace(const K& _key, Args&&... _args)
+	{
+		size_t hash = hasher(_key);
+		NodeType* res = innerFind(_key, hash);
+
+		if (res != endPtr)
+			return { res, false };
+
+		return { placeNewSlot(hash, std::forward<Args>(_args)...), true };
+	}
+
+	template<typename KT>
+	NodeType* innerSetInsert(KT&& _key)
+	{
+		std::pair<NodeType*, bool> res = innerEmplace(_key, std::forward<KT>(_key));
+
+		//         endPtr
+		return res.second ? res.first : endPtr;
+	}
+
+	template<typename KT, typename VT>
+	NodeType* innerMapInsert(KT&& _key, VT&& _value)
+	{
+		std::pair<NodeType*, bool> res = innerEmplace(_key, std::forward<KT>(_key), std::forward<VT>(_value));
+
+		//         endPtr
+		return res.second ? res.first : endPtr;
+	}
+
+	template<typename Pair>
+	NodeType* innerMapPairInsert(Pair&& _pair)
+	{
+		std::pair<NodeType*, bool> res = innerEmplace(_pair.first, std::forward<Pair>(_pair));
+
+		//         endPtr
+		return res.second ? res.first : endPtr;
+	}
+
+	//Bulk Build--------------------------------------------------------------------------------------------------------------------------------
+
+	//     [_first, _last), _getKey(*_first)   .
+	//       ,      
+	template<typename InputIterator, typename GetKey>
+	void innerBuild(InputIterator _first, InputIterator _last, const BuildOptions& _options, GetKey _getKey)
+	{
+		clear();
+
+		if (std::is_base_of<std::forward_iterator_tag, typename std::iterator_traits<InputIterator>::iterator_category>::value)
+			reserve(static_cast<size_t>(std::distance(_first, _last)));
+
+		for (; _first != _last; ++_first)
+		{
+			const KeyType& key = _getKey(*_first);
+			size_t hash = hasher(key);
+
+			if (!_options.uniqueKeys && innerFind(key, hash) != endPtr)
+				continue;
+
+			placeNewSlot(hash, *_first);
+		}
+	}
+
+	//Erasing-----------------------------------------------------------------------------------------------------------------------------------
+
+	template<typename K>
+	size_t innerEraseKey(const K& _key)
+	{
+		NodeType* res = innerFind(_key, hasher(_key));
+
+		if (res == endPtr)
+			return 0;
+
+		return eraseSingleNode(res);
+	}
+
+	//   multi,     _key   
+	template<typename K>
+	size_t innerEraseEqual(const K& _key)
+	{
+		return innerEraseKey(_key);
+	}
+
+	size_t eraseSingleNode(NodeType* _node)
+	{
+		size_t index = static_cast<size_t>(_node - slotArray);
+		size_t mask = bucketCount - 1;
+
+		_node->~NodeType();
+		--elementCount;
+
+		//       ,        ,
+		//        
+		uint32_t emptyAfter = Group(ctrlArray + index).matchEmpty();
+		uint32_t emptyBefore = Group(ctrlArray + ((index - groupWidth) & mask)).matchEmpty();
+
+		if (emptyAfter && emptyBefore && (swissCountTrailingZeros(emptyAfter) + swissCountLeadingZeros16(emptyBefore)) < groupWidth)
+		{
+			setCtrl(index, SwissControl::empty);
+		}
+		else
+		{
+			setCtrl(index, SwissControl::deleted);
+			++deletedCount;
+		}
+
+		checkLoadFactor();
+
+		return 1;
+	}
+
+	//Iterator Functional-----------------------------------------------------------------------------------------------------------------------
+
+	NodeType* findFullFrom(size_t _index) const noexcept
+	{
+		while (_index < bucketCount)
+		{
+			uint32_t full = Group(ctrlArray + _index).matchFull();
+
+			//       
+			if (bucketCount - _index < groupWidth)
+				full &= (1u << (bucketCount - _index)) - 1;
+
+			if (full)
+				return slotArray + _index + swissCountTrailingZeros(full);
+
+			_index += groupWidth;
+		}
+
+		return endPtr;
+	}
+
+	NodeType* findFullBefore(size_t _index) const noexcept
+	{
+		while (_index > 0)
+		{
+			--_index;
+
+			if (isFull(_index))
+				return slotArray + _index;
+		}
+
+		return beforeBeginPtr;
+	}
+
+	NodeType* getBegin() const noexcept
+	{
+		if (elementCount == 0)
+			return endPtr;
+
+		return findFullFrom(0);
+	}
+
+	NodeType* getBack() const noexcept
+	{
+		if (elementCount == 0)
+			return endPtr;
+
+		return findFullBefore(bucketCount);
+	}
+
+	void toNext(NodeType*& _current) const noexcept
+	{
+		if (_current == endPtr)
+			return;
+
+		if (_current == beforeBeginPtr)
+		{
+			_current = getBegin();
+			return;
+		}
+
+		_current = findFullFrom(static_cast<size_t>(_current - slotArray) + 1);
+	}
+
+	void toPrev(NodeType*& _current) const noexcept
+	{
+		if (_current == beforeBeginPtr)
+			return;
+
+		if (_current == endPtr)
+		{
+			_current = (elementCount == 0) ? beforeBeginPtr : getBack();
+			return;
+		}
+
+		_current = findFullBefore(static_cast<size_t>(_current - slotArray));
+	}
+
+//Public Methods--------------------------------------------------------------------------------------------------------------------------------
+public:
+
+	//Getting Properties------------------------------------------------------------------------------------------------------------------------
+
+	size_t size() const noexcept
+	{
+		return elementCount;
+	}
+
+	size_t getBucketCount() const noexcept
+	{
+		return bucketCount;
+	}
+
+	bool isEmpty() const noexcept
+	{
+		return (elementCount == 0) ? true : false;
+	}
+
+	float getLoadFactor() const noexcept
+	{
+		return loadFactor;
+	}
+
+	float getMaxLoadFactor() const noexcept
+	{
+		return maxLoadFactor;
+	}
+
+	float getGainFactor() const noexcept
+	{
+		return gainFactor;
+	}
+
+	float getMinLoadFactor() const noexcept
+	{
+		return minLoadFactor;
+	}
+
+	Allocator getAllocator() const noexcept
+	{
+		return allocator;
+	}
+
+	//  -  ,  -   (    )
+	HashTableMemoryUsage getMemoryUsage() const noexcept
+	{
+		HashTableMemoryUsage usage;
+		usage.bucketBytes = (bucketCount != 0) ? (bucketCount + groupWidth) * sizeof(int8_t) : 0;
+		usage.nodeBytes = bucketCount * sizeof(NodeType);
+		usage.payloadBytes = elementCount * sizeof(typename NodeType::PayloadType);
+		usage.totalBytes = usage.bucketBytes + usage.nodeBytes;
+
+		return usage;
+	}
+
+	//Setting Properties------------------------------------------------------------------------------------------------------------------------
+
+	void reserve(size_t _requiredElementCount) noexcept
+	{
+		size_t requiredBucketCount = normalizeBucketCount(static_cast<size_t>(_requiredElementCount / maxLoadFactor) + 1);
+
+		//       _requiredElementCount,   
+		if (_requiredElementCount == 0 || requiredBucketCount <= bucketCount)
+			return;
+
+		reCreate(requiredBucketCount);
+	}
+
+	bool setBucketCount(size_t _newBucketCount) noexcept
+	{
+		//  _newBucketCount     elementCount,   
+		if (_newBucketCount <= (elementCount / maxLoadFactor))
+			return false;
+
+		reCreate(normalizeBucketCount(_newBucketCount));
+		return true;
+	}
+
+	bool setMaxLoadFactor(float _newMaxLoadFactor) noexcept
+	{
+		//    maxLoadFactor     (0.0, 1.0)
+		if (_newMaxLoadFactor <= 0.0f || _newMaxLoadFactor >= 1.0f || !isValidMinLoadFactor(minLoadFactor, _newMaxLoadFactor, gainFactor))
+			return false;
+
+		maxLoadFactor = _newMaxLoadFactor;
+
+		if (bucketCount != 0 && elementCount + deletedCount > growthLimit())
+			reCreate(normalizeBucketCount(static_cast<size_t>(elementCount / maxLoadFactor) + 1));
+
+		return true;
+	}
+
+	bool setGainFactor(float _newGainFactor) noexcept
+	{
+		// gainFactor     0.0
+		if (_newGainFactor <= 0.0f || !isValidMinLoadFactor(minLoadFactor, maxLoadFactor, _newGainFactor))
+			return false;
+
+		gainFactor = _newGainFactor;
+		return true;
+	}
+
+	//  loadFactor    minLoadFactor,   . 0  
+	bool setMinLoadFactor(float _newMinLoadFactor) noexcept
+	{
+		if (!isValidMinLoadFactor(_newMinLoadFactor, maxLoadFactor, gainFactor))
+			return false;
+
+		minLoadFactor = _newMinLoadFactor;
+		checkShrink();
+		return true;
+	}
+
+	//Modifying---------------------------------------------------------------------------------------------------------------------------------
+
+	void clear()
+	{
+		destroyAllSlots();
+
+		//    ,  ,   .  ( 
+		// ) 
+		if (minLoadFactor != 0.0f && bucketCount > DefProps::sparseClearMinBuckets && bucketCount / DefProps::sparseClearRatio > elementCount)
+		{
+			freeArrays(ctrlArray, slotArray, bucketCount);
+			setEmptyArrays();
+		}
+		else if (bucketCount != 0)
+		{
+			std::memset(ctrlArray, static_cast<unsigned char>(SwissControl::empty), bucketCount + groupWidth);
+		}
+
+		elementCount = 0;
+		deletedCount = 0;
+		checkLoadFactor();
+	}
+
+	void shrinkToFit() noexcept
+	{
+		//          
+		if (elementCount == 0)
+		{
+			clear();
+			freeArrays(ctrlArray, slotArray, bucketCount);
+			setEmptyArrays();
+			checkLoadFactor();
+			return;
+		}
+
+		reCreate(normalizeBucketCount(static_cast<size_t>(elementCount / maxLoadFactor) + 1));
+	}
+
+	void swap(SwissTable& _other) noexcept
+	{
+		std::swap(ctrlArray, _other.ctrlArray);
+		std::swap(slotArray, _other.slotArray);
+		std::swap(bucketCount, _other.bucketCount);
+		std::swap(elementCount, _other.elementCount);
+		std::swap(deletedCount, _other.deletedCount);
+		std::swap(loadFactor, _other.loadFactor);
+		std::swap(maxLoadFactor, _other.maxLoadFactor);
+		std::swap(gainFactor, _other.gainFactor);
+		std::swap(minLoadFactor, _other.minLoadFactor);
+
+		swapAllocators(_other, typename std::allocator_traits<Allocator>::propagate_on_container_swap());
+	}
+
+	void merge(SwissTable& _source) noexcept
+	{
+		// ,       ,   _source
+		for (size_t i = 0; i < _source.bucketCount; ++i)
+		{
+			if (!_source.isFull(i))
+				continue;
+
+			NodeType* sourceSlot = _source.slotArray + i;
+			size_t hash = hasher(sourceSlot->getKey());
+
+			if (innerFind(sourceSlot->getKey(), hash) != endPtr)
+				continue;
+
+			size_t mixedHash = mixHash(hash);
+			size_t index = prepareSlot(mixedHash);
+
+			new (slotArray + index) NodeType(std::move(*sourceSlot));
+			commitSlot(index, mixedHash);
+
+			_source.eraseSingleNode(sourceSlot);
+		}
+	}
+
+	//Search------------------------------------------------------------------------------------------------------------------------------------
+
+	bool contains(const KeyType& _key) const noexcept
+	{
+		return innerFind(_key, hasher(_key)) != endPtr;
+	}
+
+	template<typename K, typename = EnableTransparentLookup<Hasher, EqualComp, K>>
+	bool contains(const K& _key) const noexcept
+	{
+		return innerFind(_key, hasher(_key)) != endPtr;
+	}
+
+	//    _count    _results,     .   
+	size_t containsBatch(const KeyType* _keys, size_t _count, bool* _results) const noexcept
+	{
+		size_t found = 0;
+
+		innerFindBatch(_keys, _count, [this, &found, &_results](NodeType* _node)
+			{
+				*_results = (_node != endPtr);
+				found += *_results++;
+			});
+
+		return found;
+	}
+
+	size_t countByKey(const KeyType& _key) const noexcept
+	{
+		return contains(_key) ? 1 : 0;
+	}
+
+	template<typename K, typename = EnableTransparentLookup<Hasher, EqualComp, K>>
+	size_t countByKey(const K& _key) const noexcept
+	{
+		return contains(_key) ? 1 : 0;
+	}
+
+	//Erasing-----------------------------------------------------------------------------------------------------------------------------------
+
+	size_t eraseEqual(const KeyType& _key)
+	{
+		size_t count = innerEraseEqual(_key);
+		checkShrink();
+
+		return count;
+	}
+
+	template<typename K, typename = EnableTransparentLookup<Hasher, EqualComp, K>>
+	size_t eraseEqual(const K& _key)
+	{
+		size_t count = innerEraseEqual(_key);
+		checkShrink();
+
+		return count;
+	}
+};
+
+#endif // !_SWISS_TABLE_BASIC_H_